@@ -0,0 +1,252 @@
+#include "include/alarm_engine.h"
+#include "../common/include/can_clock.h"
+#include <string.h>
+
+static int16_t central_alarm_shift(int16_t value, int32_t delta);
+static int16_t central_alarm_crossed(const central_alarm_rule_t *rule, int16_t value, uint8_t prev_level, uint8_t level);
+static int32_t central_alarm_band_hysteresis(int16_t low, int16_t high, int16_t hysteresis_raw);
+
+bool central_alarm_init(central_alarm_engine_t *engine, uint32_t capacity)
+{
+    if (!engine || capacity > (1u << 24))
+    {
+        return false;
+    }
+
+    memset(engine, 0, sizeof(central_alarm_engine_t));
+    engine->capacity = can_next_pow2(capacity ? capacity : CENTRAL_ALARM_RING_CAPACITY);
+    engine->mask = engine->capacity - 1;
+    engine->slots = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(central_alarm_slot_t) * engine->capacity);
+    if (!engine->slots)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < engine->capacity; i++)
+    {
+        atomic_init(&engine->slots[i].stamp, 0);
+        atomic_init(&engine->slots[i].acked_seq, 0);
+    }
+    atomic_init(&engine->next_seq, 1);
+
+    return true;
+}
+
+void central_alarm_free(central_alarm_engine_t *engine)
+{
+    if (!engine)
+    {
+        return;
+    }
+
+    can_aligned_free(engine->slots);
+    memset(engine, 0, sizeof(central_alarm_engine_t));
+}
+
+// 임계값을 전송값 스케일로 등록 (해제 구간은 hysteresis_raw 만큼 안쪽, debounce 0 은 1로 취급)
+// 구간 폭의 절반보다 큰 히스테리시스는 절반으로 줄임 (해제 구간이 뒤집히면 다시 해제되지 않음)
+can_error_t central_alarm_set_rule(central_alarm_engine_t *engine, uint8_t sensor_id, const sensor_threshold_raw_t *threshold,
+                                   int16_t hysteresis_raw, uint8_t debounce)
+{
+    if (!engine || !threshold || hysteresis_raw < 0 ||
+        threshold->warning_low > threshold->warning_high || threshold->error_low > threshold->error_high)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    int32_t warning_h = central_alarm_band_hysteresis(threshold->warning_low, threshold->warning_high, hysteresis_raw);
+    int32_t error_h = central_alarm_band_hysteresis(threshold->error_low, threshold->error_high, hysteresis_raw);
+
+    central_alarm_rule_t *rule = &engine->rules[sensor_id];
+    rule->enter = *threshold;
+    rule->clear.warning_low = central_alarm_shift(threshold->warning_low, warning_h);
+    rule->clear.warning_high = central_alarm_shift(threshold->warning_high, -warning_h);
+    rule->clear.error_low = central_alarm_shift(threshold->error_low, error_h);
+    rule->clear.error_high = central_alarm_shift(threshold->error_high, -error_h);
+    rule->level = SENSOR_OK;
+    rule->pending = SENSOR_OK;
+    rule->pending_cnt = 0;
+    rule->debounce = debounce ? debounce : 1;
+
+    return CAN_SUCCESS;
+}
+
+void central_alarm_clear_rule(central_alarm_engine_t *engine, uint8_t sensor_id)
+{
+    if (!engine)
+    {
+        return;
+    }
+
+    memset(&engine->rules[sensor_id], 0, sizeof(central_alarm_rule_t));
+}
+
+// 레벨 전이를 확정하고 알람 링에 기록 (central_alarm_evaluate 에서 호출, 제어 장치 스레드 전용)
+void central_alarm_transition(central_alarm_engine_t *engine, uint8_t sensor_id, uint32_t can_id, int16_t value, uint8_t level)
+{
+    central_alarm_rule_t *rule = &engine->rules[sensor_id];
+    uint8_t prev_level = rule->level;
+
+    rule->level = level;
+    rule->pending = level;
+    rule->pending_cnt = 0;
+
+    uint64_t seq = atomic_load_explicit(&engine->next_seq, memory_order_relaxed);
+    central_alarm_slot_t *slot = &engine->slots[seq & engine->mask];
+
+    // 기록 중에는 stamp 를 0 으로 두어 읽는 쪽이 버리게 함
+    atomic_store_explicit(&slot->stamp, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->alarm.seq = seq;
+    slot->alarm.timestamp_ns = can_clock_now_ns();
+    slot->alarm.can_id = can_id;
+    slot->alarm.sensor_id = sensor_id;
+    slot->alarm.level = level;
+    slot->alarm.prev_level = prev_level;
+    slot->alarm.value = value;
+    slot->alarm.threshold = central_alarm_crossed(rule, value, prev_level, level);
+
+    atomic_store_explicit(&slot->stamp, seq, memory_order_release);
+    atomic_store_explicit(&engine->next_seq, seq + 1, memory_order_release);
+
+    _Atomic uint64_t *counter = level > prev_level ? &engine->raised : &engine->cleared;
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+// *cursor 번 알람부터 최대 max 개 복사 (덮어써진 알람은 건너뜀, cursor 는 다음 읽을 번호로 갱신, 복사한 수 반환)
+int central_alarm_read(const central_alarm_engine_t *engine, uint64_t *cursor, central_alarm_t *alarms, int max)
+{
+    if (!engine || !cursor || !alarms || max <= 0)
+    {
+        return 0;
+    }
+
+    uint64_t end = atomic_load_explicit(&engine->next_seq, memory_order_acquire);
+    uint64_t seq = *cursor ? *cursor : 1;
+    if (end > engine->capacity && seq < end - engine->capacity)
+    {
+        seq = end - engine->capacity;
+    }
+
+    int n = 0;
+    for (; seq < end && n < max; seq++)
+    {
+        const central_alarm_slot_t *slot = &engine->slots[seq & engine->mask];
+        if (atomic_load_explicit(&slot->stamp, memory_order_acquire) != seq)
+        {
+            continue;
+        }
+
+        alarms[n] = slot->alarm;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->stamp, memory_order_relaxed) == seq)
+        {
+            n++;
+        }
+    }
+
+    *cursor = seq;
+    return n;
+}
+
+// 알람 확인 (이미 덮어써진 알람이면 실패)
+can_error_t central_alarm_ack(central_alarm_engine_t *engine, uint64_t seq)
+{
+    if (!engine || seq == 0)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    central_alarm_slot_t *slot = &engine->slots[seq & engine->mask];
+    if (atomic_load_explicit(&slot->stamp, memory_order_acquire) != seq)
+    {
+        return CAN_ERROR_QUEUE_EMPTY;
+    }
+
+    // 확인 표시는 알람 번호로 남기므로 칸이 재사용되어도 새 알람에 잘못 붙지 않음
+    uint64_t prev = atomic_exchange_explicit(&slot->acked_seq, seq, memory_order_acq_rel);
+    if (prev != seq)
+    {
+        atomic_fetch_add_explicit(&engine->acked, 1, memory_order_relaxed);
+    }
+
+    return CAN_SUCCESS;
+}
+
+bool central_alarm_is_acked(const central_alarm_engine_t *engine, uint64_t seq)
+{
+    if (!engine || seq == 0)
+    {
+        return false;
+    }
+
+    const central_alarm_slot_t *slot = &engine->slots[seq & engine->mask];
+    return atomic_load_explicit(&slot->acked_seq, memory_order_acquire) == seq;
+}
+
+uint8_t central_alarm_level(const central_alarm_engine_t *engine, uint8_t sensor_id)
+{
+    return engine ? engine->rules[sensor_id].level : SENSOR_OK;
+}
+
+void central_alarm_get_stats(const central_alarm_engine_t *engine, central_alarm_stats_t *stats)
+{
+    if (!engine || !stats)
+    {
+        return;
+    }
+
+    memset(stats, 0, sizeof(central_alarm_stats_t));
+    stats->raised = atomic_load_explicit(&engine->raised, memory_order_relaxed);
+    stats->cleared = atomic_load_explicit(&engine->cleared, memory_order_relaxed);
+    stats->acked = atomic_load_explicit(&engine->acked, memory_order_relaxed);
+    stats->recorded = atomic_load_explicit(&engine->next_seq, memory_order_relaxed) - 1;
+
+    for (int i = 0; i < CENTRAL_ALARM_SENSORS; i++)
+    {
+        stats->active += engine->rules[i].level >= SENSOR_WARNING;
+    }
+}
+
+// ------------- static method -------------
+// int16 범위로 포화시키며 더하기
+static int16_t central_alarm_shift(int16_t value, int32_t delta)
+{
+    int32_t shifted = (int32_t)value + delta;
+    if (shifted > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (shifted < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)shifted;
+}
+
+// 전이에 관계된 임계값 (상승: 넘은 진입 임계값, 하강: 들어온 해제 임계값)
+static int16_t central_alarm_crossed(const central_alarm_rule_t *rule, int16_t value, uint8_t prev_level, uint8_t level)
+{
+    if (level > prev_level)
+    {
+        if (level == SENSOR_ERROR)
+        {
+            return value > rule->enter.error_high ? rule->enter.error_high : rule->enter.error_low;
+        }
+        return value > rule->enter.warning_high ? rule->enter.warning_high : rule->enter.warning_low;
+    }
+
+    if (prev_level == SENSOR_ERROR)
+    {
+        return value > rule->clear.error_low ? rule->clear.error_high : rule->clear.error_low;
+    }
+    return value > rule->clear.warning_low ? rule->clear.warning_high : rule->clear.warning_low;
+}
+
+// 구간 [low, high] 에 쓸 히스테리시스 (폭의 절반 이하로 제한)
+static int32_t central_alarm_band_hysteresis(int16_t low, int16_t high, int16_t hysteresis_raw)
+{
+    int32_t half = ((int32_t)high - (int32_t)low) / 2;
+    return hysteresis_raw < half ? hysteresis_raw : half;
+}
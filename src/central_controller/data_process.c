@@ -1,4 +1,6 @@
 #include "include/data_processor.h"
+#include "../common/include/can_log.h"
+#include "../common/include/can_clock.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,33 +13,127 @@ static sensor_threshold_t defualt_thresholds[] = {
     {2, 10.0, 0.5, 15.0, 0.0},
     {3, 20.0, 0.0, 50.0, 0.0}};
 
+static can_error_t central_on_sensor_data(void *ctx, uint32_t can_id, const sensor_data_msg_t *msg);
+static can_error_t central_on_alarm(void *ctx, uint32_t can_id, const alarm_msg_t *msg);
+static can_error_t central_on_status(void *ctx, uint32_t can_id, const status_msg_t *msg);
+static can_error_t central_on_heartbeat(void *ctx, uint32_t can_id, const status_msg_t *msg);
+static void central_on_liveness(void *ctx, uint8_t sensor_id, uint8_t status, uint64_t last_seen_ns);
+
 can_error_t central_init(central_controller_t *controller, const char *interface_name)
 {
-    if (!controller || !interface_name)
+    central_config_t config = {0};
+    config.history_depth = DATA_HISTORY_SIZE;
+    config.rolling_window = CENTRAL_ROLLING_WINDOW;
+    config.ewma_alpha = CENTRAL_EWMA_ALPHA;
+
+    return central_init_ex(controller, interface_name, &config);
+}
+
+can_error_t central_init_ex(central_controller_t *controller, const char *interface_name, const central_config_t *config)
+{
+    if (!controller || !interface_name || !config)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
     memset(controller, 0, sizeof(central_controller_t));
+    controller->history_depth = config->history_depth ? config->history_depth : DATA_HISTORY_SIZE;
+    controller->rolling_window = config->rolling_window ? config->rolling_window : CENTRAL_ROLLING_WINDOW;
+    controller->ewma_alpha = config->ewma_alpha > 0 ? config->ewma_alpha : CENTRAL_EWMA_ALPHA;
+    controller->archive_config = config->archive;
+    central_dispatch_init(&controller->dispatch);
+
+    if (!central_alarm_init(&controller->alarms, config->alarm_capacity))
+    {
+        printf("[CENTRAL] Failed to create alarm ring\n");
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    if (config->store_dir)
+    {
+        controller->store = sensor_store_open(config->store_dir, &config->store);
+        if (!controller->store)
+        {
+            central_alarm_free(&controller->alarms);
+            return CAN_ERROR_INIT_FAILED;
+        }
+    }
+
+    uint32_t liveness_timeout_ms = config->liveness_timeout_ms ? config->liveness_timeout_ms : CENTRAL_LIVENESS_TIMEOUT_MS;
+    if (!sensor_liveness_init(&controller->liveness, liveness_timeout_ms, can_clock_now_ns()))
+    {
+        printf("[CENTRAL] Failed to create liveness wheel\n");
+        sensor_store_close(controller->store);
+        central_alarm_free(&controller->alarms);
+        return CAN_ERROR_INIT_FAILED;
+    }
+    controller->liveness.on_change = central_on_liveness;
+    controller->liveness.ctx = controller;
+
+    // 기본 임계값은 전송값 스케일로 바꿔서 등록
+    for (size_t i = 0; i < sizeof(defualt_thresholds) / sizeof(defualt_thresholds[0]); i++)
+    {
+        central_set_threshold(controller, &defualt_thresholds[i], CENTRAL_ALARM_DEFAULT_HYSTERESIS, CENTRAL_ALARM_DEFAULT_DEBOUNCE);
+    }
 
     // CAN 인터페이스 생성
-    can_error_t result = can_create_interface(&controller->can_interface, interface_name, 0x001);
+    can_error_t result = can_create_interface_on_bus(&controller->can_interface, interface_name, 0x001, config->bus_id);
     if (result != CAN_SUCCESS)
     {
         printf("[CENTRAL] Faild to create CAN interface\n");
+        sensor_liveness_free(&controller->liveness);
+        sensor_store_close(controller->store);
+        central_alarm_free(&controller->alarms);
         return result;
     }
 
-    // CAN 연결
-    can_set_filter(&controller->can_interface, 0x100, 0x300);
+    // 센서/시스템 메시지 ID 범위만 수신
+    can_filter_rule_t rules[] = {
+        can_filter_range_rule(CAN_ID_TEMPERATURE_BASE, CAN_ID_PRESSURE_BASE - 1, false),
+        can_filter_range_rule(CAN_ID_PRESSURE_BASE, CAN_ID_VIBRATION_BASE - 1, false),
+        can_filter_range_rule(CAN_ID_VIBRATION_BASE, CAN_ID_SYSTEM_BASE - 1, false),
+        can_filter_range_rule(CAN_ID_SYSTEM_BASE, CAN_ID_SYSTEM_END - 1, false)};
+    can_set_filter_bank(&controller->can_interface, rules, sizeof(rules) / sizeof(rules[0]));
+
+    // 센서 계열 및 시스템 메시지 핸들러 등록
+    central_register_sensor_family(controller, CAN_ID_TEMPERATURE_BASE, CAN_ID_PRESSURE_BASE - 1);
+    central_register_sensor_family(controller, CAN_ID_PRESSURE_BASE, CAN_ID_VIBRATION_BASE - 1);
+    central_register_sensor_family(controller, CAN_ID_VIBRATION_BASE, CAN_ID_SYSTEM_BASE - 1);
+
+    central_msg_handler_t system_handler = {0};
+    system_handler.on_status = central_on_status;
+    system_handler.on_heartbeat = central_on_heartbeat;
+    system_handler.ctx = controller;
+    central_register_handler(controller, CAN_ID_SYSTEM_BASE, CAN_ID_SYSTEM_END - 1, false, &system_handler);
 
     controller->is_running = false;
-    controller->start_time = time(NULL);
+    controller->start_time = can_clock_wall_time();
 
     printf("[CENTRAL] Central Controller '%s' initialized\n", interface_name);
     return CAN_SUCCESS;
 }
 
+// 센서 히스토리 해제
+void central_cleanup(central_controller_t *controller)
+{
+    if (!controller)
+    {
+        return;
+    }
+
+    for (int i = 0; i < MAX_SENSORS; i++)
+    {
+        sensor_history_free(&controller->sensor_history[i]);
+        sensor_rolling_free(&controller->sensor_rolling[i]);
+        sensor_archive_free(&controller->sensor_archive[i]);
+    }
+    sensor_liveness_free(&controller->liveness);
+    sensor_store_close(controller->store);
+    controller->store = NULL;
+    central_alarm_free(&controller->alarms);
+    controller->active_sensor_cnt = 0;
+}
+
 // 모니터링 시작
 can_error_t central_start_monitoring(central_controller_t *controller)
 {
@@ -70,29 +166,375 @@ can_error_t central_process_can_frame(central_controller_t *controller, const ca
     {
         return CAN_ERROR_INVALID_PARAM;
     }
-    printf("[CENTRAL] CAN Frame received - ID: 0x%03X, DLC: %d\n", frame->id, frame->dlc);
 
-    // CAN ID 기반으로 메시지 타입 판별
-    if (frame->id >= CAN_ID_TEMPERATURE_BASE && frame->id < CAN_ID_PRESSURE_BASE)
+    can_log_frame(CAN_LOG_CAT_CENTRAL, CAN_LOG_TRACE, "PROC", controller->can_interface.interface_name, frame);
+
+    // CAN ID 로 등록된 핸들러를 찾아 메시지 타입별 디코더로 바로 전달
+    can_error_t result = central_dispatch_frame(&controller->dispatch, frame);
+    if (result != CAN_SUCCESS)
     {
-        // 온도 센서 데이터 처리
+        can_log_write(CAN_LOG_CAT_CENTRAL, CAN_LOG_DEBUG, "[CENTRAL] Frame rejected: ID=0x%03llX, error=-%llu",
+                      frame->id, (uint64_t)-(int64_t)result, 0, 0);
     }
-    else if (frame->id >= CAN_ID_PRESSURE_BASE && frame->id < CAN_ID_VIBRATION_BASE)
+    return result;
+}
+
+// 버스 콜백 (can_bus_config_t.handler, ctx: central_controller_t)
+// 버스가 호출을 직렬화하므로 제어 장치 상태는 한 스레드에서만 갱신됨, central_poll 과 함께 사용하지 않음
+void central_on_bus_frames(void *ctx, const can_frame_t *frames, int n)
+{
+    central_controller_t *controller = ctx;
+
+    for (int i = 0; i < n; i++)
     {
-        // 압력 센서 데이터 처리
+        central_process_can_frame(controller, &frames[i]);
     }
-    else if (frame->id >= CAN_ID_VIBRATION_BASE && frame->id < CAN_ID_SYSTEM_BASE)
+    controller->total_messages_received += n;
+    central_check_liveness(controller);
+    sensor_store_flush(controller->store);
+}
+
+// 수신 마감이 지난 센서를 SENSOR_OFFLINE 으로 표시 (만료된 센서만 처리, 새로 오프라인이 된 센서 수 반환)
+uint32_t central_check_liveness(central_controller_t *controller)
+{
+    if (!controller)
     {
-        // 진동 센서 데이터 처리
+        return 0;
     }
-    else if (frame->id >= CAN_ID_SYSTEM_BASE && frame->id < 0x500)
+
+    return sensor_liveness_poll(&controller->liveness, can_clock_now_ns());
+}
+
+// 센서 수신 상태 (SENSOR_OK / SENSOR_OFFLINE, 한 번도 수신하지 않았으면 SENSOR_OFFLINE)
+uint8_t central_sensor_status(const central_controller_t *controller, uint8_t sensor_id)
+{
+    return controller ? sensor_liveness_status(&controller->liveness, sensor_id) : SENSOR_OFFLINE;
+}
+
+// CAN ID 범위에 메시지 핸들러 등록
+can_error_t central_register_handler(central_controller_t *controller, uint32_t id_first, uint32_t id_last,
+                                     bool is_extended, const central_msg_handler_t *handler)
+{
+    if (!controller || !handler)
     {
-        // 시스템 데이터
+        return CAN_ERROR_INVALID_PARAM;
     }
-    else
+
+    can_error_t result = central_dispatch_register(&controller->dispatch, id_first, id_last, is_extended, handler);
+    if (result != CAN_SUCCESS)
+    {
+        printf("[CENTRAL] Failed to register handler (ID: 0x%03X-0x%03X)\n", id_first, id_last);
+    }
+    return result;
+}
+
+// 기본 센서 핸들러(데이터/알람/상태/하트비트)로 새 센서 계열 등록
+can_error_t central_register_sensor_family(central_controller_t *controller, uint32_t id_first, uint32_t id_last)
+{
+    central_msg_handler_t handler = {0};
+    handler.on_sensor_data = central_on_sensor_data;
+    handler.on_alarm = central_on_alarm;
+    handler.on_status = central_on_status;
+    handler.on_heartbeat = central_on_heartbeat;
+    handler.ctx = controller;
+
+    return central_register_handler(controller, id_first, id_last, false, &handler);
+}
+
+// 메시지가 도착할 때까지 대기한 뒤 쌓인 메시지를 한 번에 처리
+can_error_t central_poll(central_controller_t *controller, int timeout_ms)
+{
+    if (!controller)
     {
-        printf("[CENTRAL] Unknown message type (ID: 0x%03X)", frame->id);
         return CAN_ERROR_INVALID_PARAM;
     }
+
+    can_frame_t frames[CENTRAL_POLL_BUDGET];
+    int received = can_receive_batch(&controller->can_interface, frames, CENTRAL_POLL_BUDGET, timeout_ms);
+    if (received < 0)
+    {
+        return (can_error_t)received;
+    }
+
+    for (int i = 0; i < received; i++)
+    {
+        central_process_can_frame(controller, &frames[i]);
+    }
+    controller->total_messages_received += received;
+    central_check_liveness(controller);
+    sensor_store_flush(controller->store);
+
+    return CAN_SUCCESS;
+}
+// 최근 window 개 샘플의 min/max/mean/stddev/RMS (window 0: 저장된 전체)
+can_error_t central_get_sensor_stats(const central_controller_t *controller, uint8_t sensor_id, uint32_t window, sensor_stats_t *stats)
+{
+    if (!controller || !stats || sensor_id >= MAX_SENSORS)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    const sensor_history_t *history = &controller->sensor_history[sensor_id];
+    sensor_history_span_t span;
+    sensor_stats_acc_t acc;
+
+    sensor_stats_acc_init(&acc);
+    sensor_history_window(history, window ? window : history->cnt, &span);
+    for (int i = 0; i < 2; i++)
+    {
+        sensor_stats_accumulate(&acc, history->value + span.start[i], span.len[i]);
+    }
+
+    sensor_stats_finalize(&acc, stats);
+    return stats->count > 0 ? CAN_SUCCESS : CAN_ERROR_QUEUE_EMPTY;
+}
+
+// 최근 window 개 샘플 중 경고/에러 구간에 들어간 샘플 수
+can_error_t central_scan_thresholds(const central_controller_t *controller, uint8_t sensor_id, uint32_t window,
+                                    const sensor_threshold_t *threshold, sensor_scan_result_t *result)
+{
+    if (!controller || !threshold || !result || sensor_id >= MAX_SENSORS)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    const sensor_history_t *history = &controller->sensor_history[sensor_id];
+    sensor_history_span_t span;
+    sensor_threshold_raw_t raw;
+
+    central_threshold_to_raw(threshold, &raw);
+    memset(result, 0, sizeof(sensor_scan_result_t));
+    sensor_history_window(history, window ? window : history->cnt, &span);
+    for (int i = 0; i < 2; i++)
+    {
+        sensor_stats_scan(result, history->value + span.start[i], span.len[i], &raw);
+    }
+
+    return CAN_SUCCESS;
+}
+
+// float 임계값을 전송값 스케일(int16, 0.01)로 변환
+void central_threshold_to_raw(const sensor_threshold_t *threshold, sensor_threshold_raw_t *raw)
+{
+    raw->warning_low = sensor_value_to_raw(threshold->warning_low);
+    raw->warning_high = sensor_value_to_raw(threshold->warning_high);
+    raw->error_low = sensor_value_to_raw(threshold->error_low);
+    raw->error_high = sensor_value_to_raw(threshold->error_high);
+}
+
+// 알람 임계값 등록 (float -> 전송값 스케일 변환은 여기서 한 번만 수행)
+can_error_t central_set_threshold(central_controller_t *controller, const sensor_threshold_t *threshold, float hysteresis, uint8_t debounce)
+{
+    if (!controller || !threshold || hysteresis < 0)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    sensor_threshold_raw_t raw;
+    central_threshold_to_raw(threshold, &raw);
+    return central_alarm_set_rule(&controller->alarms, threshold->sensor_id, &raw, sensor_value_to_raw(hysteresis), debounce);
+}
+
+// 장기 보관에서 [t0_ns, t1_ns) 구간 샘플 조회 (시각은 us 단위로 버림, 복사한 수 반환)
+int central_query_history(const central_controller_t *controller, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                          sensor_sample_t *samples, int max)
+{
+    if (!controller || sensor_id >= MAX_SENSORS)
+    {
+        return 0;
+    }
+
+    return sensor_archive_query(&controller->sensor_archive[sensor_id], t0_ns, t1_ns, samples, max);
+}
+
+// [t0_ns, t1_ns) 와 겹치는 1s/1min/1h 롤업 구간 조회 (복사한 수 반환)
+int central_query_rollup(const central_controller_t *controller, uint8_t sensor_id, sensor_rollup_tier_t tier,
+                         uint64_t t0_ns, uint64_t t1_ns, sensor_rollup_bucket_t *buckets, int max)
+{
+    if (!controller || sensor_id >= MAX_SENSORS)
+    {
+        return 0;
+    }
+
+    return sensor_archive_rollup(&controller->sensor_archive[sensor_id], tier, t0_ns, t1_ns, buckets, max);
+}
+
+// 디스크 세그먼트에서 [t0_ns, t1_ns) 구간 샘플 조회 (시각은 벽시계 ns, 재시작 전 기록 포함, 복사한 수 반환)
+int central_query_store(const central_controller_t *controller, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                        sensor_sample_t *samples, int max)
+{
+    if (!controller || !controller->store)
+    {
+        return 0;
+    }
+
+    return sensor_store_query(controller->store, sensor_id, t0_ns, t1_ns, samples, max);
+}
+
+// 현재 윈도우 통계를 재계산 없이 바로 조회
+can_error_t central_get_rolling_stats(const central_controller_t *controller, uint8_t sensor_id, sensor_rolling_stats_t *stats)
+{
+    if (!controller || !stats || sensor_id >= MAX_SENSORS)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    const sensor_rolling_t *rolling = &controller->sensor_rolling[sensor_id];
+    if (rolling->window == 0)
+    {
+        memset(stats, 0, sizeof(sensor_rolling_stats_t));
+        return CAN_ERROR_QUEUE_EMPTY;
+    }
+
+    sensor_rolling_snapshot(rolling, stats);
+    return CAN_SUCCESS;
+}
+
+// 센서별 시퀀스 통계 (수신한 적이 없으면 CAN_ERROR_QUEUE_EMPTY)
+can_error_t central_get_sequence_stats(const central_controller_t *controller, uint8_t sensor_id, sensor_sequence_stats_t *stats)
+{
+    if (!controller || !stats)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    *stats = controller->sequence[sensor_id].stats;
+    return stats->received > 0 ? CAN_SUCCESS : CAN_ERROR_QUEUE_EMPTY;
+}
+
+// 이 제어 장치의 인터페이스로 받은 전체 센서의 시퀀스 통계 합계
+void central_get_interface_sequence_stats(const central_controller_t *controller, sensor_sequence_stats_t *stats)
+{
+    if (!controller || !stats)
+    {
+        return;
+    }
+
+    memset(stats, 0, sizeof(sensor_sequence_stats_t));
+    for (int i = 0; i < SENSOR_SEQUENCE_SENSORS; i++)
+    {
+        sensor_sequence_accumulate(stats, &controller->sequence[i].stats);
+    }
+}
+
+void central_print_sensor_stats(const central_controller_t *controller, uint8_t sensor_id)
+{
+    sensor_stats_t stats;
+
+    if (central_get_sensor_stats(controller, sensor_id, 0, &stats) != CAN_SUCCESS)
+    {
+        printf("[CENTRAL] Sensor %d: no data\n", sensor_id);
+        return;
+    }
+
+    printf("[CENTRAL] Sensor %d stats (%llu samples)\n", sensor_id, (unsigned long long)stats.count);
+    printf("  min: %.2f, max: %.2f, mean: %.2f\n", sensor_raw_to_value(stats.min), sensor_raw_to_value(stats.max), stats.mean);
+    printf("  stddev: %.3f, rms: %.3f\n", stats.stddev, stats.rms);
+
+    sensor_sequence_stats_t sequence;
+    if (central_get_sequence_stats(controller, sensor_id, &sequence) == CAN_SUCCESS)
+    {
+        printf("  lost: %llu/%llu (%.3f%%), late: %llu, duplicate: %llu\n", (unsigned long long)sequence.lost,
+               (unsigned long long)sequence.expected, sensor_sequence_loss_rate(&sequence) * 100.0,
+               (unsigned long long)sequence.late, (unsigned long long)sequence.duplicate);
+    }
 }
 // ------------- static method -------------
+static can_error_t central_on_sensor_data(void *ctx, uint32_t can_id, const sensor_data_msg_t *msg)
+{
+    central_controller_t *controller = ctx;
+
+    sensor_liveness_touch(&controller->liveness, msg->sensor_id, can_clock_now_ns());
+    if (sensor_sequence_observe(&controller->sequence[msg->sensor_id], msg->sequence) == SENSOR_SEQ_GAP)
+    {
+        can_log_write(CAN_LOG_CAT_CENTRAL, CAN_LOG_DEBUG, "[CENTRAL] Sequence gap: sensor %llu, seq=%llu, lost=%llu",
+                      msg->sensor_id, msg->sequence, controller->sequence[msg->sensor_id].stats.lost, 0);
+    }
+    central_alarm_evaluate(&controller->alarms, msg->sensor_id, can_id, msg->value);
+    if (controller->store)
+    {
+        sensor_store_append(controller->store, can_clock_wall_ns(), msg);
+    }
+
+    if (msg->sensor_id >= MAX_SENSORS)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    sensor_history_t *history = &controller->sensor_history[msg->sensor_id];
+    sensor_rolling_t *rolling = &controller->sensor_rolling[msg->sensor_id];
+    sensor_archive_t *archive = &controller->sensor_archive[msg->sensor_id];
+    if (history->depth == 0)
+    {
+        if (!sensor_history_init(history, controller->history_depth))
+        {
+            return CAN_ERROR_INIT_FAILED;
+        }
+        if (!sensor_rolling_init(rolling, controller->rolling_window, controller->ewma_alpha))
+        {
+            sensor_history_free(history);
+            return CAN_ERROR_INIT_FAILED;
+        }
+        if (!sensor_archive_init(archive, &controller->archive_config))
+        {
+            sensor_rolling_free(rolling);
+            sensor_history_free(history);
+            return CAN_ERROR_INIT_FAILED;
+        }
+        controller->active_sensor_cnt++;
+    }
+
+    uint64_t now_ns = can_clock_now_ns();
+    sensor_history_append(history, now_ns, msg);
+    sensor_archive_append(archive, now_ns, msg);
+    sensor_rolling_update(rolling, msg->value);
+
+    return CAN_SUCCESS;
+}
+
+static can_error_t central_on_alarm(void *ctx, uint32_t can_id, const alarm_msg_t *msg)
+{
+    central_controller_t *controller = ctx;
+    (void)can_id;
+    (void)msg;
+
+    controller->alarm_cnt++;
+    return CAN_SUCCESS;
+}
+
+static can_error_t central_on_status(void *ctx, uint32_t can_id, const status_msg_t *msg)
+{
+    (void)ctx;
+    (void)can_id;
+    (void)msg;
+    return CAN_SUCCESS;
+}
+
+static can_error_t central_on_heartbeat(void *ctx, uint32_t can_id, const status_msg_t *msg)
+{
+    central_controller_t *controller = ctx;
+    (void)can_id;
+
+    sensor_liveness_touch(&controller->liveness, msg->node_id, can_clock_now_ns());
+    if (msg->node_id < MAX_SENSORS)
+    {
+        controller->sensor_history[msg->node_id].last_update = can_clock_wall_time();
+    }
+    return CAN_SUCCESS;
+}
+
+// 센서 수신 상태 변화 기록
+static void central_on_liveness(void *ctx, uint8_t sensor_id, uint8_t status, uint64_t last_seen_ns)
+{
+    (void)ctx;
+
+    if (status == SENSOR_OFFLINE)
+    {
+        can_log_write(CAN_LOG_CAT_CENTRAL, CAN_LOG_WARN, "[CENTRAL] Sensor %llu offline (last seen %llu ns)",
+                      sensor_id, last_seen_ns, 0, 0);
+    }
+    else
+    {
+        can_log_write(CAN_LOG_CAT_CENTRAL, CAN_LOG_DEBUG, "[CENTRAL] Sensor %llu online", sensor_id, 0, 0, 0);
+    }
+}
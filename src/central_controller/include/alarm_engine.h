@@ -0,0 +1,129 @@
+#ifndef ALARM_ENGINE_H
+#define ALARM_ENGINE_H
+
+#include "../../common/include/can_interface.h"
+#include "../../common/include/message_type.h"
+#include "../../common/include/can_platform.h"
+#include "sensor_stats.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define CENTRAL_ALARM_SENSORS 256          // sensor_id (uint8) 로 바로 인덱싱
+#define CENTRAL_ALARM_RING_CAPACITY 1024   // 기본 알람 링 용량 (2의 거듭제곱으로 올림, 가득 차면 오래된 알람부터 덮어씀)
+#define CENTRAL_ALARM_DEFAULT_DEBOUNCE 3   // 레벨이 바뀌려면 연속으로 필요한 샘플 수
+#define CENTRAL_ALARM_DEFAULT_HYSTERESIS 1.0f // 해제 시 임계값 안쪽으로 들어와야 하는 폭 (실제값)
+
+// 센서별 알람 규칙과 상태 (전송값 스케일, 한 캐시 라인의 절반)
+typedef struct
+{
+    sensor_threshold_raw_t enter; // 이 구간을 벗어나면 레벨 진입
+    sensor_threshold_raw_t clear; // 현재 레벨에서 빠져나오려면 이 구간 안쪽으로 들어와야 함
+    uint8_t debounce;             // 0: 규칙 없음 (평가하지 않음)
+    uint8_t level;                // 확정 레벨 (SENSOR_OK / SENSOR_WARNING / SENSOR_ERROR)
+    uint8_t pending;              // 전이 후보 레벨
+    uint8_t pending_cnt;          // 후보 레벨이 연속으로 나온 횟수
+} central_alarm_rule_t;
+
+// 알람 기록 (레벨 전이 하나, level 이 SENSOR_OK 이면 해제)
+typedef struct
+{
+    uint64_t seq; // 알람 번호 (1부터 증가)
+    uint64_t timestamp_ns;
+    uint32_t can_id;
+    uint8_t sensor_id;
+    uint8_t level;
+    uint8_t prev_level;
+    int16_t value;     // 전이를 확정한 샘플
+    int16_t threshold; // 넘은 (해제: 안쪽으로 들어온) 임계값
+} central_alarm_t;
+
+// 알람 링 칸 (stamp: 기록된 알람 번호, 0 이면 기록 중)
+typedef struct
+{
+    _Atomic uint64_t stamp;
+    _Atomic uint64_t acked_seq; // stamp 와 같으면 확인된 알람
+    central_alarm_t alarm;
+} central_alarm_slot_t;
+
+// 알람 엔진 (평가와 기록은 제어 장치 스레드 하나, 조회와 확인은 어느 스레드에서나)
+typedef struct
+{
+    central_alarm_rule_t rules[CENTRAL_ALARM_SENSORS];
+
+    central_alarm_slot_t *slots;
+    uint32_t capacity;
+    uint32_t mask;
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t next_seq; // 다음에 기록할 알람 번호
+    _Atomic uint64_t raised;
+    _Atomic uint64_t cleared;
+    _Atomic uint64_t acked;
+} central_alarm_engine_t;
+
+// 알람 통계
+typedef struct
+{
+    uint64_t raised;  // WARNING/ERROR 진입 (레벨 상승 포함)
+    uint64_t cleared; // 레벨 하강 (OK 로 해제 포함)
+    uint64_t acked;
+    uint64_t recorded; // 링에 기록된 전체 알람 수
+    uint32_t active;   // 현재 WARNING 이상인 센서 수
+} central_alarm_stats_t;
+
+// function
+bool central_alarm_init(central_alarm_engine_t *engine, uint32_t capacity);
+void central_alarm_free(central_alarm_engine_t *engine);
+can_error_t central_alarm_set_rule(central_alarm_engine_t *engine, uint8_t sensor_id, const sensor_threshold_raw_t *threshold,
+                                   int16_t hysteresis_raw, uint8_t debounce);
+void central_alarm_clear_rule(central_alarm_engine_t *engine, uint8_t sensor_id);
+void central_alarm_transition(central_alarm_engine_t *engine, uint8_t sensor_id, uint32_t can_id, int16_t value, uint8_t level);
+int central_alarm_read(const central_alarm_engine_t *engine, uint64_t *cursor, central_alarm_t *alarms, int max);
+can_error_t central_alarm_ack(central_alarm_engine_t *engine, uint64_t seq);
+bool central_alarm_is_acked(const central_alarm_engine_t *engine, uint64_t seq);
+uint8_t central_alarm_level(const central_alarm_engine_t *engine, uint8_t sensor_id);
+void central_alarm_get_stats(const central_alarm_engine_t *engine, central_alarm_stats_t *stats);
+
+// 프레임마다 호출 (규칙 조회 1번과 정수 비교 몇 번, 레벨이 확정적으로 바뀔 때만 기록, 확정 레벨 반환)
+static inline uint8_t central_alarm_evaluate(central_alarm_engine_t *engine, uint8_t sensor_id, uint32_t can_id, int16_t value)
+{
+    central_alarm_rule_t *rule = &engine->rules[sensor_id];
+    if (rule->debounce == 0)
+    {
+        return SENSOR_OK;
+    }
+
+    // 현재 레벨 이상은 해제 구간, 그 밖은 진입 구간으로 판정
+    const sensor_threshold_raw_t *error = rule->level >= SENSOR_ERROR ? &rule->clear : &rule->enter;
+    const sensor_threshold_raw_t *warning = rule->level >= SENSOR_WARNING ? &rule->clear : &rule->enter;
+
+    uint8_t target = SENSOR_OK;
+    if (value > error->error_high || value < error->error_low)
+    {
+        target = SENSOR_ERROR;
+    }
+    else if (value > warning->warning_high || value < warning->warning_low)
+    {
+        target = SENSOR_WARNING;
+    }
+
+    if (target == rule->level)
+    {
+        rule->pending_cnt = 0;
+        return rule->level;
+    }
+
+    if (target != rule->pending || rule->pending_cnt == 0)
+    {
+        rule->pending = target;
+        rule->pending_cnt = 0;
+    }
+
+    if (++rule->pending_cnt >= rule->debounce)
+    {
+        central_alarm_transition(engine, sensor_id, can_id, value, target);
+    }
+
+    return rule->level;
+}
+#endif
@@ -4,51 +4,113 @@
 #include "../../common/include/can_interface.h"
 #include "../../common/include/message_type.h"
 #include "../../sensor_nodes/include/sensor_common.h"
+#include "message_dispatch.h"
+#include "sensor_history.h"
+#include "sensor_stats.h"
+#include "sensor_rolling.h"
+#include "alarm_engine.h"
+#include "sensor_liveness.h"
+#include "sensor_sequence.h"
+#include "sensor_archive.h"
+#include "sensor_store.h"
 #include <stdbool.h>
 #include <time.h>
 
 #define MAX_SENSORS 32
-#define DATA_HISTORY_SIZE 100
-#define MAX_ALARMS 50
+#define DATA_HISTORY_SIZE 1024 // 기본 히스토리 깊이 (2의 거듭제곱으로 올림)
+#define CENTRAL_POLL_BUDGET 256     // central_poll 1회당 최대 처리 메시지 수
+#define CENTRAL_ROLLING_WINDOW 256   // 기본 증분 통계 윈도우 (샘플 수)
+#define CENTRAL_EWMA_ALPHA 0.1       // 기본 EWMA 계수
+#define CENTRAL_LIVENESS_TIMEOUT_MS (HEARTBEAT_INTERVAL_MS * 3) // 이 시간 동안 수신이 없으면 SENSOR_OFFLINE
 
 #pragma pack(push, 1)
-// 센서 데이터 히스토리
+// 임계값 설정
+typedef struct
+{
+    uint8_t sensor_id;
+    float warning_high;
+    float warning_low;
+    float error_high;
+    float error_low;
+} sensor_threshold_t;
+#pragma pack(pop)
+
+// 중앙 제어 장치 설정
 typedef struct
 {
-    sensor_data_msg_t data[DATA_HISTORY_SIZE];
-    int head;
-    int cnt;
-    time_t last_update;
-} sensor_history_t;
+    uint32_t history_depth;  // 센서별 히스토리 깊이 (0이면 DATA_HISTORY_SIZE)
+    uint32_t rolling_window; // 증분 통계 윈도우 (0이면 CENTRAL_ROLLING_WINDOW)
+    double ewma_alpha;       // EWMA 계수 (0이면 CENTRAL_EWMA_ALPHA)
+    uint32_t bus_id;         // 인터페이스를 만들 버스 (0이면 기본 버스)
+    uint32_t alarm_capacity; // 알람 링 용량 (0이면 CENTRAL_ALARM_RING_CAPACITY)
+    uint32_t liveness_timeout_ms; // 센서 수신 마감 (0이면 CENTRAL_LIVENESS_TIMEOUT_MS)
+    sensor_archive_config_t archive; // 장기 보관 블록/롤업 수 (0이면 기본값)
+    const char *store_dir;           // 디스크 세그먼트 저장 디렉터리 (NULL 이면 저장하지 않음)
+    sensor_store_config_t store;     // 세그먼트 시간 창/크기 (0이면 기본값)
+} central_config_t;
 
-// 중앙 제어 장치
+// 중앙 제어 장치 (원자 변수와 함수 포인터를 포함하므로 pack 하지 않음)
 typedef struct
 {
     can_interface_t can_interface;
-    sensor_history_t sensor_history[MAX_SENSORS];
+    sensor_history_t sensor_history[MAX_SENSORS]; // 첫 데이터 수신 시 할당
+    sensor_rolling_t sensor_rolling[MAX_SENSORS]; // 센서별 증분 통계 (히스토리와 함께 할당)
+    sensor_archive_t sensor_archive[MAX_SENSORS]; // 센서별 압축 장기 보관 (히스토리와 함께 할당)
+    sensor_archive_config_t archive_config;
+    uint32_t history_depth;
+    uint32_t rolling_window;
+    double ewma_alpha;
     int active_sensor_cnt;
     bool is_running;
 
+    // CAN ID -> 메시지 핸들러
+    central_dispatch_t dispatch;
+
+    // 센서 데이터 알람 평가 (sensor_id 로 인덱싱)
+    central_alarm_engine_t alarms;
+
+    // 센서별 수신 마감 (데이터/하트비트마다 다시 걸고 만료된 센서만 OFFLINE 처리)
+    sensor_liveness_t liveness;
+
+    // 센서별 시퀀스 번호 추적 (손실/중복/순서 바뀜)
+    sensor_sequence_t sequence[SENSOR_SEQUENCE_SENSORS];
+
+    // 디스크 세그먼트 저장소 (NULL: 저장하지 않음)
+    sensor_store_t *store;
+
     // 통계 정보
     uint32_t total_messages_received;
-    uint32_t alarm_cnt;
+    uint32_t alarm_cnt; // 수신한 알람 메시지 수
     time_t start_time;
 } central_controller_t;
 
-// 임계값 설정
-typedef struct
-{
-    uint8_t sensor_id;
-    float warning_high;
-    float warning_low;
-    float error_high;
-    float error_low;
-} sensor_threshold_t;
-#pragma pack(pop)
-
 // 함수 선언
 can_error_t central_init(central_controller_t *controller, const char *interface_name);
+can_error_t central_init_ex(central_controller_t *controller, const char *interface_name, const central_config_t *config);
+void central_cleanup(central_controller_t *controller);
 can_error_t central_start_monitoring(central_controller_t *controller);
 can_error_t central_stop_monitoring(central_controller_t *controller);
-can_error_t central_process_can_frame(central_controller_t *controller, const char *frame);
+can_error_t central_process_can_frame(central_controller_t *controller, const can_frame_t *frame);
+can_error_t central_poll(central_controller_t *controller, int timeout_ms);
+void central_on_bus_frames(void *ctx, const can_frame_t *frames, int n);
+uint32_t central_check_liveness(central_controller_t *controller);
+uint8_t central_sensor_status(const central_controller_t *controller, uint8_t sensor_id);
+can_error_t central_register_handler(central_controller_t *controller, uint32_t id_first, uint32_t id_last,
+                                     bool is_extended, const central_msg_handler_t *handler);
+can_error_t central_register_sensor_family(central_controller_t *controller, uint32_t id_first, uint32_t id_last);
+can_error_t central_get_sensor_stats(const central_controller_t *controller, uint8_t sensor_id, uint32_t window, sensor_stats_t *stats);
+can_error_t central_scan_thresholds(const central_controller_t *controller, uint8_t sensor_id, uint32_t window,
+                                    const sensor_threshold_t *threshold, sensor_scan_result_t *result);
+void central_threshold_to_raw(const sensor_threshold_t *threshold, sensor_threshold_raw_t *raw);
+can_error_t central_set_threshold(central_controller_t *controller, const sensor_threshold_t *threshold, float hysteresis, uint8_t debounce);
+can_error_t central_get_sequence_stats(const central_controller_t *controller, uint8_t sensor_id, sensor_sequence_stats_t *stats);
+void central_get_interface_sequence_stats(const central_controller_t *controller, sensor_sequence_stats_t *stats);
+int central_query_history(const central_controller_t *controller, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                          sensor_sample_t *samples, int max);
+int central_query_rollup(const central_controller_t *controller, uint8_t sensor_id, sensor_rollup_tier_t tier,
+                         uint64_t t0_ns, uint64_t t1_ns, sensor_rollup_bucket_t *buckets, int max);
+int central_query_store(const central_controller_t *controller, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                        sensor_sample_t *samples, int max);
+can_error_t central_get_rolling_stats(const central_controller_t *controller, uint8_t sensor_id, sensor_rolling_stats_t *stats);
+void central_print_sensor_stats(const central_controller_t *controller, uint8_t sensor_id);
 #endif
@@ -0,0 +1,47 @@
+#ifndef MESSAGE_DISPATCH_H
+#define MESSAGE_DISPATCH_H
+
+#include "../../common/include/can_interface.h"
+#include "../../common/include/message_type.h"
+
+#define CENTRAL_DISPATCH_MAX_HANDLERS 32
+#define CENTRAL_DISPATCH_EXT_CAPACITY 1024 // 확장 ID 해시 테이블 크기 (2의 거듭제곱)
+#define CENTRAL_DISPATCH_MSG_TYPES 256
+
+// 메시지 타입별 핸들러 (디코딩된 구조체를 전달)
+typedef can_error_t (*central_sensor_data_fn)(void *ctx, uint32_t can_id, const sensor_data_msg_t *msg);
+typedef can_error_t (*central_alarm_fn)(void *ctx, uint32_t can_id, const alarm_msg_t *msg);
+typedef can_error_t (*central_status_fn)(void *ctx, uint32_t can_id, const status_msg_t *msg);
+
+// CAN ID 범위에 등록되는 핸들러 묶음 (NULL 인 항목은 해당 메시지 거부)
+typedef struct
+{
+    central_sensor_data_fn on_sensor_data;
+    central_alarm_fn on_alarm;
+    central_status_fn on_status;
+    central_status_fn on_heartbeat;
+    void *ctx;
+} central_msg_handler_t;
+
+typedef can_error_t (*central_decoder_fn)(const central_msg_handler_t *handler, const can_frame_t *frame);
+
+// CAN ID -> 핸들러 디스패치 테이블
+typedef struct
+{
+    central_msg_handler_t handlers[CENTRAL_DISPATCH_MAX_HANDLERS]; // [0]: 미등록 ID 용
+    int handler_cnt;
+
+    uint8_t std_index[CAN_STD_ID_COUNT];              // 표준 ID -> 핸들러 인덱스
+    uint32_t ext_keys[CENTRAL_DISPATCH_EXT_CAPACITY]; // 확장 ID (+1, 0: 빈 칸)
+    uint8_t ext_index[CENTRAL_DISPATCH_EXT_CAPACITY]; // 확장 ID -> 핸들러 인덱스
+    int ext_cnt;
+
+    central_decoder_fn decoders[CENTRAL_DISPATCH_MSG_TYPES]; // 메시지 타입 -> 디코더
+} central_dispatch_t;
+
+// function
+void central_dispatch_init(central_dispatch_t *dispatch);
+can_error_t central_dispatch_register(central_dispatch_t *dispatch, uint32_t id_first, uint32_t id_last,
+                                      bool is_extended, const central_msg_handler_t *handler);
+can_error_t central_dispatch_frame(const central_dispatch_t *dispatch, const can_frame_t *frame);
+#endif
@@ -0,0 +1,94 @@
+#ifndef SENSOR_ARCHIVE_H
+#define SENSOR_ARCHIVE_H
+
+#include "sensor_history.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SENSOR_ARCHIVE_BLOCK_BYTES 1024     // 압축 블록 크기 (블록 단위로 보관하고 버림)
+#define SENSOR_ARCHIVE_MAX_SAMPLE_BYTES 20  // 샘플 하나가 차지할 수 있는 최대 바이트 수
+#define SENSOR_ARCHIVE_TICK_NS 1000ull      // 보관 시각 해상도 (1 us, 그 아래는 버림)
+#define SENSOR_ARCHIVE_DEFAULT_BLOCKS 1024  // 기본 블록 수 (2의 거듭제곱으로 올림, 가득 차면 오래된 블록부터 버림)
+#define SENSOR_ROLLUP_DEFAULT_1S 4096       // 1초 구간 보관 수 (약 1시간)
+#define SENSOR_ROLLUP_DEFAULT_1M 16384      // 1분 구간 보관 수 (약 11일)
+#define SENSOR_ROLLUP_DEFAULT_1H 16384      // 1시간 구간 보관 수 (약 1.8년)
+
+// 롤업 단계
+typedef enum
+{
+    SENSOR_ROLLUP_1S = 0,
+    SENSOR_ROLLUP_1M,
+    SENSOR_ROLLUP_1H,
+    SENSOR_ROLLUP_TIERS
+} sensor_rollup_tier_t;
+
+// 압축 블록 (첫 샘플 시각 기준 delta-of-delta 시각 + zigzag varint 값 차분)
+typedef struct
+{
+    uint64_t first_tick; // 첫 샘플 시각 (SENSOR_ARCHIVE_TICK_NS 단위)
+    uint64_t last_tick;  // 마지막 샘플 시각
+    int16_t min;
+    int16_t max;
+    uint16_t cnt;  // 샘플 수
+    uint16_t used; // data 에 쓴 바이트 수
+    uint8_t data[SENSOR_ARCHIVE_BLOCK_BYTES];
+} sensor_archive_block_t;
+
+// 롤업 구간 (전송값 단위, 평균 = sum / cnt)
+typedef struct
+{
+    uint64_t start_ns;
+    int64_t sum;
+    uint32_t cnt;
+    int16_t min;
+    int16_t max;
+} sensor_rollup_bucket_t;
+
+// 롤업 단계 하나 (완료된 구간의 링 + 채우는 중인 구간)
+typedef struct
+{
+    uint64_t width_ns;
+    sensor_rollup_bucket_t *buckets;
+    uint32_t capacity; // 2의 거듭제곱
+    uint32_t mask;
+    uint64_t written; // 지금까지 완료된 구간 수
+    sensor_rollup_bucket_t open;
+} sensor_rollup_t;
+
+// 센서별 장기 보관 (압축 블록 링 + 1s/1min/1h 롤업, 시각 순서로 추가)
+typedef struct
+{
+    sensor_archive_block_t *blocks;
+    uint32_t capacity; // 블록 수 (2의 거듭제곱)
+    uint32_t mask;
+    uint64_t written; // 지금까지 연 블록 수 (마지막 블록에 추가 중)
+
+    // 마지막 블록의 인코더 상태
+    uint64_t prev_tick;
+    int64_t prev_delta;
+    int16_t prev_value;
+    uint8_t prev_status;
+    uint16_t prev_sequence;
+
+    sensor_rollup_t rollup[SENSOR_ROLLUP_TIERS];
+
+    uint64_t sample_cnt; // 지금까지 추가한 샘플 수
+    uint64_t dropped_blocks;
+} sensor_archive_t;
+
+// 보관 설정 (0 이면 기본값)
+typedef struct
+{
+    uint32_t blocks;
+    uint32_t rollup_buckets[SENSOR_ROLLUP_TIERS]; // 단계별 보관 구간 수
+} sensor_archive_config_t;
+
+// function
+bool sensor_archive_init(sensor_archive_t *archive, const sensor_archive_config_t *config);
+void sensor_archive_free(sensor_archive_t *archive);
+void sensor_archive_append(sensor_archive_t *archive, uint64_t timestamp_ns, const sensor_data_msg_t *msg);
+int sensor_archive_query(const sensor_archive_t *archive, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max);
+int sensor_archive_rollup(const sensor_archive_t *archive, sensor_rollup_tier_t tier, uint64_t t0_ns, uint64_t t1_ns,
+                          sensor_rollup_bucket_t *buckets, int max);
+double sensor_archive_bytes_per_sample(const sensor_archive_t *archive);
+#endif
@@ -0,0 +1,46 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include "../../common/include/message_type.h"
+#include "../../common/include/can_platform.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 센서 데이터 히스토리 (열 단위 링 버퍼, 각 배열은 캐시 라인 정렬)
+typedef struct
+{
+    uint64_t *timestamp_ns; // 수신 시각
+    int16_t *value;         // 센서값 (resolution: 0.01)
+    uint8_t *status;        // 센서 상태
+    uint16_t *sequence;     // 시퀀스 번호
+
+    uint32_t depth; // 저장 가능한 샘플 수 (2의 거듭제곱)
+    uint32_t mask;
+    uint64_t head;  // 지금까지 기록된 샘플 수 (다음 쓰기 위치)
+    uint32_t cnt;   // 저장된 샘플 수
+    time_t last_update;
+} sensor_history_t;
+
+// 최근 n개 샘플이 놓인 연속 구간 (링이 한 바퀴 돌면 두 구간으로 나뉨)
+typedef struct
+{
+    uint32_t start[2];
+    uint32_t len[2];
+} sensor_history_span_t;
+
+// 단일 샘플
+typedef struct
+{
+    uint64_t timestamp_ns;
+    int16_t value;
+    uint8_t status;
+    uint16_t sequence;
+} sensor_sample_t;
+
+// function
+bool sensor_history_init(sensor_history_t *history, uint32_t depth);
+void sensor_history_free(sensor_history_t *history);
+void sensor_history_append(sensor_history_t *history, uint64_t timestamp_ns, const sensor_data_msg_t *msg);
+uint32_t sensor_history_window(const sensor_history_t *history, uint32_t n, sensor_history_span_t *span);
+bool sensor_history_get(const sensor_history_t *history, uint32_t age, sensor_sample_t *sample);
+#endif
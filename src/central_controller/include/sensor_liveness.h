@@ -0,0 +1,39 @@
+#ifndef SENSOR_LIVENESS_H
+#define SENSOR_LIVENESS_H
+
+#include "../../common/include/can_timer_wheel.h"
+#include "../../common/include/message_type.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SENSOR_LIVENESS_SENSORS 256 // sensor_id (uint8) 로 바로 인덱싱
+#define SENSOR_LIVENESS_TICK_NS 1000000ull // 마감 해상도 (1 ms)
+
+// 센서 상태가 바뀔 때 호출 (SENSOR_OK: 다시 수신, SENSOR_OFFLINE: 마감 초과)
+typedef void (*sensor_liveness_fn)(void *ctx, uint8_t sensor_id, uint8_t status, uint64_t last_seen_ns);
+
+// 센서별 수신 마감 추적 (수신할 때마다 마감을 다시 걸고, 만료된 센서만 처리)
+typedef struct
+{
+    can_timer_wheel_t wheel; // 타이머 번호 = sensor_id
+    uint64_t start_ns;       // 틱 0 의 시각
+    uint32_t timeout_ms;
+
+    bool seen[SENSOR_LIVENESS_SENSORS];     // 한 번이라도 수신한 센서
+    uint8_t status[SENSOR_LIVENESS_SENSORS]; // SENSOR_OK / SENSOR_OFFLINE
+    uint64_t last_seen_ns[SENSOR_LIVENESS_SENSORS];
+
+    uint32_t online_cnt;
+    uint64_t offline_events;
+
+    sensor_liveness_fn on_change; // NULL: 알림 없음
+    void *ctx;
+} sensor_liveness_t;
+
+// function
+bool sensor_liveness_init(sensor_liveness_t *liveness, uint32_t timeout_ms, uint64_t now_ns);
+void sensor_liveness_free(sensor_liveness_t *liveness);
+void sensor_liveness_touch(sensor_liveness_t *liveness, uint8_t sensor_id, uint64_t now_ns);
+uint32_t sensor_liveness_poll(sensor_liveness_t *liveness, uint64_t now_ns);
+uint8_t sensor_liveness_status(const sensor_liveness_t *liveness, uint8_t sensor_id);
+#endif
@@ -0,0 +1,54 @@
+#ifndef SENSOR_ROLLING_H
+#define SENSOR_ROLLING_H
+
+#include "sensor_stats.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// 단조 덱 (윈도우 내 최소/최대 후보의 샘플 번호)
+typedef struct
+{
+    uint64_t *index;
+    uint32_t head;
+    uint32_t len;
+} sensor_deque_t;
+
+// 센서별 증분 통계 (샘플마다 O(1) 갱신, 조회 O(1))
+typedef struct
+{
+    uint32_t window; // 윈도우 길이 (샘플 수)
+    uint32_t cnt;    // 윈도우에 들어있는 샘플 수
+    uint64_t total;  // 지금까지 들어온 샘플 수
+    int16_t *values; // 윈도우 값 (빠져나갈 값 조회용)
+
+    // 윈도우 합계 (정수로 누적하여 오차 없음)
+    int64_t sum;
+    uint64_t sum_sq;
+    sensor_deque_t min_deque;
+    sensor_deque_t max_deque;
+
+    // 전체 기간 Welford 평균/분산 (전송값 단위)
+    double welford_mean;
+    double welford_m2;
+
+    // 지수 이동 평균 (전송값 단위)
+    double ewma_alpha;
+    double ewma;
+} sensor_rolling_t;
+
+// 조회 결과 (window 는 sensor_stats_t 와 같은 단위)
+typedef struct
+{
+    sensor_stats_t window;
+    double ewma;
+    uint64_t lifetime_cnt;
+    double lifetime_mean;
+    double lifetime_stddev;
+} sensor_rolling_stats_t;
+
+// function
+bool sensor_rolling_init(sensor_rolling_t *rolling, uint32_t window, double ewma_alpha);
+void sensor_rolling_free(sensor_rolling_t *rolling);
+void sensor_rolling_update(sensor_rolling_t *rolling, int16_t value);
+void sensor_rolling_snapshot(const sensor_rolling_t *rolling, sensor_rolling_stats_t *stats);
+#endif
@@ -0,0 +1,48 @@
+#ifndef SENSOR_SEQUENCE_H
+#define SENSOR_SEQUENCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SENSOR_SEQUENCE_SENSORS 256 // sensor_id (uint8) 로 바로 인덱싱
+#define SENSOR_SEQUENCE_WINDOW 64   // 늦게 온 프레임을 구분할 수 있는 범위 (최고 번호 기준)
+#define SENSOR_SEQUENCE_RESYNC 4    // 창보다 오래된 번호가 연속으로 이만큼 오면 센서 재시작으로 보고 다시 맞춤
+
+// 프레임 분류
+typedef enum
+{
+    SENSOR_SEQ_IN_ORDER = 0, // 최고 번호 + 1
+    SENSOR_SEQ_GAP,          // 앞으로 건너뜀 (사이 번호는 손실로 계산)
+    SENSOR_SEQ_LATE,         // 최고 번호보다 작고 처음 받은 번호 (손실에서 되돌림)
+    SENSOR_SEQ_DUPLICATE     // 이미 받은 번호
+} sensor_seq_class_t;
+
+// 시퀀스 통계 (센서별, 또는 인터페이스 전체 합계)
+typedef struct
+{
+    uint64_t expected;  // 최고 번호가 지나온 번호 수 (받았어야 할 프레임 수)
+    uint64_t received;  // 받은 프레임 수 (중복 포함)
+    uint64_t in_order;
+    uint64_t gaps;      // 건너뜀 발생 횟수
+    uint64_t late;
+    uint64_t duplicate;
+    uint64_t lost;      // 아직 받지 못한 번호 수 (늦게 오면 줄어듦)
+    uint64_t resync;    // 센서 재시작으로 다시 맞춘 횟수
+} sensor_sequence_stats_t;
+
+// 센서별 시퀀스 추적 (16비트 번호 순환 처리, 최근 64개 수신 여부 비트맵)
+typedef struct
+{
+    uint64_t window;    // 비트 i: (highest - i) 번을 받았는지
+    uint16_t highest;   // 지금까지 받은 가장 앞선 번호
+    bool started;
+    uint8_t stale_run;  // 창보다 오래된 번호가 연속으로 온 횟수
+    sensor_sequence_stats_t stats;
+} sensor_sequence_t;
+
+// function
+void sensor_sequence_reset(sensor_sequence_t *sequence);
+sensor_seq_class_t sensor_sequence_observe(sensor_sequence_t *sequence, uint16_t number);
+void sensor_sequence_accumulate(sensor_sequence_stats_t *total, const sensor_sequence_stats_t *stats);
+double sensor_sequence_loss_rate(const sensor_sequence_stats_t *stats);
+#endif
@@ -0,0 +1,60 @@
+#ifndef SENSOR_STATS_H
+#define SENSOR_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// 합계 누적값 (구간별로 계산한 뒤 합칠 수 있음)
+typedef struct
+{
+    uint64_t count;
+    int16_t min;
+    int16_t max;
+    int64_t sum;
+    uint64_t sum_sq;
+} sensor_stats_acc_t;
+
+// 통계 결과 (min/max 는 전송값, 나머지는 실제값 단위)
+typedef struct
+{
+    uint64_t count;
+    int16_t min;
+    int16_t max;
+    double mean;
+    double stddev; // 모집단 표준편차
+    double rms;
+} sensor_stats_t;
+
+// 전송값 스케일의 임계값 구간
+typedef struct
+{
+    int16_t warning_low;
+    int16_t warning_high;
+    int16_t error_low;
+    int16_t error_high;
+} sensor_threshold_raw_t;
+
+// 임계값 검사 결과
+typedef struct
+{
+    uint64_t warning_cnt; // 경고 구간 샘플 수 (에러 제외)
+    uint64_t error_cnt;   // 에러 구간 샘플 수
+} sensor_scan_result_t;
+
+// 사용 중인 커널 종류
+typedef enum
+{
+    SENSOR_KERNEL_SCALAR = 0,
+    SENSOR_KERNEL_SSE2 = 1,
+    SENSOR_KERNEL_AVX2 = 2
+} sensor_kernel_t;
+
+// function
+void sensor_stats_acc_init(sensor_stats_acc_t *acc);
+void sensor_stats_accumulate(sensor_stats_acc_t *acc, const int16_t *values, size_t n);
+void sensor_stats_finalize(const sensor_stats_acc_t *acc, sensor_stats_t *stats);
+void sensor_stats_scan(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold);
+sensor_kernel_t sensor_stats_kernel(void);
+void sensor_stats_force_kernel(sensor_kernel_t kernel);
+#endif
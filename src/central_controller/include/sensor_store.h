@@ -0,0 +1,91 @@
+#ifndef SENSOR_STORE_H
+#define SENSOR_STORE_H
+
+#include "../../common/include/can_interface.h"
+#include "../../common/include/message_type.h"
+#include "sensor_history.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define SENSOR_STORE_MAGIC 0x47455353u       // "SSEG" (little endian)
+#define SENSOR_STORE_FOOTER_MAGIC 0x58444953u // "SIDX"
+#define SENSOR_STORE_VERSION 1
+#define SENSOR_STORE_WINDOW_NS 3600000000000ull // 기본 세그먼트 시간 창 (1시간)
+#define SENSOR_STORE_SEGMENT_RECORDS (1u << 20) // 기본 세그먼트 최대 레코드 수 (창이 끝나기 전이라도 넘으면 봉인)
+#define SENSOR_STORE_INDEX_STRIDE 64            // 센서별 레코드 몇 개마다 색인 항목을 둘지
+
+#pragma pack(push, 1)
+// 세그먼트 파일 헤더 (32 bytes)
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint64_t window_start_ns; // 이 세그먼트가 담는 시간 창 시작 (벽시계 ns)
+    uint64_t window_ns;
+    uint32_t seq; // 세그먼트 번호 (파일 이름과 같음)
+    uint32_t reserved;
+} sensor_store_header_t;
+
+// 샘플 레코드 (16 bytes, check 가 맞지 않으면 기록 중 끊긴 레코드)
+typedef struct
+{
+    uint64_t timestamp_ns; // 벽시계 ns
+    int16_t value;
+    uint16_t sequence;
+    uint8_t sensor_id;
+    uint8_t status;
+    uint16_t check;
+} sensor_store_record_t;
+
+// 희소 색인 항목 (16 bytes, (sensor_id, timestamp_ns) 순서)
+typedef struct
+{
+    uint64_t timestamp_ns;
+    uint32_t record_idx;
+    uint8_t sensor_id;
+    uint8_t reserved[3];
+} sensor_store_index_t;
+
+// 봉인된 세그먼트 끝 (48 bytes, 이게 없으면 복구 대상)
+typedef struct
+{
+    uint64_t record_cnt;
+    uint64_t index_offset;
+    uint32_t index_cnt;
+    uint32_t reserved;
+    uint64_t min_ts_ns;
+    uint64_t max_ts_ns;
+    uint32_t magic;
+    uint32_t check;
+} sensor_store_footer_t;
+#pragma pack(pop)
+
+// 세그먼트 저장소 (제어 장치 스레드 하나에서 추가/조회, 정렬/기록/fsync 하는 봉인은 저장소의 봉인 스레드가 함)
+typedef struct sensor_store sensor_store_t;
+
+// 저장소 설정 (0 이면 기본값)
+typedef struct
+{
+    uint64_t window_ns;
+    uint32_t segment_records;
+} sensor_store_config_t;
+
+// 저장소 통계
+typedef struct
+{
+    uint32_t segments;          // 봉인된 세그먼트 수
+    uint64_t sealed_records;    // 봉인된 세그먼트의 레코드 수
+    uint64_t active_records;    // 기록 중인 세그먼트의 레코드 수 (봉인 스레드가 봉인 중인 것 포함)
+    uint64_t recovered_records; // 시작할 때 봉인되지 않은 세그먼트에서 살린 레코드 수
+} sensor_store_stats_t;
+
+// function
+sensor_store_t *sensor_store_open(const char *dir, const sensor_store_config_t *config);
+void sensor_store_close(sensor_store_t *store);
+can_error_t sensor_store_append(sensor_store_t *store, uint64_t timestamp_ns, const sensor_data_msg_t *msg);
+can_error_t sensor_store_flush(sensor_store_t *store);
+int sensor_store_query(const sensor_store_t *store, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max);
+void sensor_store_get_stats(const sensor_store_t *store, sensor_store_stats_t *stats);
+#endif
@@ -0,0 +1,226 @@
+#include "include/message_dispatch.h"
+
+static can_error_t central_decode_sensor_data(const central_msg_handler_t *handler, const can_frame_t *frame);
+static can_error_t central_decode_alarm(const central_msg_handler_t *handler, const can_frame_t *frame);
+static can_error_t central_decode_status(const central_msg_handler_t *handler, const can_frame_t *frame);
+static can_error_t central_decode_heartbeat(const central_msg_handler_t *handler, const can_frame_t *frame);
+static can_error_t central_decode_unsupported(const central_msg_handler_t *handler, const can_frame_t *frame);
+static can_error_t central_reject_sensor_data(void *ctx, uint32_t can_id, const sensor_data_msg_t *msg);
+static can_error_t central_reject_alarm(void *ctx, uint32_t can_id, const alarm_msg_t *msg);
+static can_error_t central_reject_status(void *ctx, uint32_t can_id, const status_msg_t *msg);
+static uint32_t central_ext_hash(uint32_t id);
+static int central_ext_lookup(const central_dispatch_t *dispatch, uint32_t id);
+
+void central_dispatch_init(central_dispatch_t *dispatch)
+{
+    memset(dispatch, 0, sizeof(central_dispatch_t));
+
+    // 0번 핸들러: 미등록 ID 는 모두 거부
+    central_msg_handler_t *unknown = &dispatch->handlers[0];
+    unknown->on_sensor_data = central_reject_sensor_data;
+    unknown->on_alarm = central_reject_alarm;
+    unknown->on_status = central_reject_status;
+    unknown->on_heartbeat = central_reject_status;
+    dispatch->handler_cnt = 1;
+
+    for (int i = 0; i < CENTRAL_DISPATCH_MSG_TYPES; i++)
+    {
+        dispatch->decoders[i] = central_decode_unsupported;
+    }
+    dispatch->decoders[MSG_TYPE_SENSOR_DATA] = central_decode_sensor_data;
+    dispatch->decoders[MSG_TYPE_ALARM] = central_decode_alarm;
+    dispatch->decoders[MSG_TYPE_STATUS] = central_decode_status;
+    dispatch->decoders[MSG_TYPE_HEARTBEAT] = central_decode_heartbeat;
+}
+
+// CAN ID 범위 [id_first, id_last] 에 핸들러 등록
+can_error_t central_dispatch_register(central_dispatch_t *dispatch, uint32_t id_first, uint32_t id_last,
+                                      bool is_extended, const central_msg_handler_t *handler)
+{
+    if (!dispatch || !handler || id_first > id_last)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (dispatch->handler_cnt >= CENTRAL_DISPATCH_MAX_HANDLERS)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    if (!is_extended && id_last >= CAN_STD_ID_COUNT)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (is_extended && (id_last > CAN_EXT_ID_MASK ||
+                        dispatch->ext_cnt + (id_last - id_first + 1) > CENTRAL_DISPATCH_EXT_CAPACITY / 2))
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    // 비어있는 콜백은 거부 함수로 채워 디스패치 시 NULL 검사 제거
+    uint8_t index = (uint8_t)dispatch->handler_cnt++;
+    central_msg_handler_t *entry = &dispatch->handlers[index];
+    *entry = *handler;
+    if (!entry->on_sensor_data)
+    {
+        entry->on_sensor_data = central_reject_sensor_data;
+    }
+    if (!entry->on_alarm)
+    {
+        entry->on_alarm = central_reject_alarm;
+    }
+    if (!entry->on_status)
+    {
+        entry->on_status = central_reject_status;
+    }
+    if (!entry->on_heartbeat)
+    {
+        entry->on_heartbeat = central_reject_status;
+    }
+
+    for (uint32_t id = id_first;; id++)
+    {
+        if (!is_extended)
+        {
+            dispatch->std_index[id] = index;
+        }
+        else
+        {
+            int slot = central_ext_lookup(dispatch, id);
+            if (dispatch->ext_keys[slot] == 0)
+            {
+                dispatch->ext_keys[slot] = id + 1;
+                dispatch->ext_cnt++;
+            }
+            dispatch->ext_index[slot] = index;
+        }
+
+        if (id == id_last)
+        {
+            break;
+        }
+    }
+
+    return CAN_SUCCESS;
+}
+
+// CAN ID 와 메시지 타입으로 테이블 조회 후 바로 디코더 호출
+can_error_t central_dispatch_frame(const central_dispatch_t *dispatch, const can_frame_t *frame)
+{
+    if (!dispatch || !frame || frame->dlc < 2)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t index;
+    if (!frame->is_extended && frame->id < CAN_STD_ID_COUNT)
+    {
+        index = dispatch->std_index[frame->id];
+    }
+    else
+    {
+        index = dispatch->ext_index[central_ext_lookup(dispatch, frame->id & CAN_EXT_ID_MASK)];
+    }
+
+    return dispatch->decoders[frame->data[1]](&dispatch->handlers[index], frame);
+}
+
+// ------------- static method -------------
+static can_error_t central_decode_sensor_data(const central_msg_handler_t *handler, const can_frame_t *frame)
+{
+    sensor_data_msg_t msg;
+    if (frame->dlc < sizeof(msg))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(&msg, frame->data, sizeof(msg));
+    return handler->on_sensor_data(handler->ctx, frame->id, &msg);
+}
+
+static can_error_t central_decode_alarm(const central_msg_handler_t *handler, const can_frame_t *frame)
+{
+    alarm_msg_t msg;
+    if (frame->dlc < sizeof(msg))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(&msg, frame->data, sizeof(msg));
+    return handler->on_alarm(handler->ctx, frame->id, &msg);
+}
+
+static can_error_t central_decode_status(const central_msg_handler_t *handler, const can_frame_t *frame)
+{
+    status_msg_t msg;
+    if (frame->dlc < sizeof(msg))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(&msg, frame->data, sizeof(msg));
+    return handler->on_status(handler->ctx, frame->id, &msg);
+}
+
+// 하트비트는 상태 메시지와 같은 레이아웃
+static can_error_t central_decode_heartbeat(const central_msg_handler_t *handler, const can_frame_t *frame)
+{
+    status_msg_t msg;
+    if (frame->dlc < sizeof(msg))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(&msg, frame->data, sizeof(msg));
+    return handler->on_heartbeat(handler->ctx, frame->id, &msg);
+}
+
+static can_error_t central_decode_unsupported(const central_msg_handler_t *handler, const can_frame_t *frame)
+{
+    (void)handler;
+    (void)frame;
+    return CAN_ERROR_INVALID_PARAM;
+}
+
+static can_error_t central_reject_sensor_data(void *ctx, uint32_t can_id, const sensor_data_msg_t *msg)
+{
+    (void)ctx;
+    (void)can_id;
+    (void)msg;
+    return CAN_ERROR_INVALID_PARAM;
+}
+
+static can_error_t central_reject_alarm(void *ctx, uint32_t can_id, const alarm_msg_t *msg)
+{
+    (void)ctx;
+    (void)can_id;
+    (void)msg;
+    return CAN_ERROR_INVALID_PARAM;
+}
+
+static can_error_t central_reject_status(void *ctx, uint32_t can_id, const status_msg_t *msg)
+{
+    (void)ctx;
+    (void)can_id;
+    (void)msg;
+    return CAN_ERROR_INVALID_PARAM;
+}
+
+static uint32_t central_ext_hash(uint32_t id)
+{
+    // Fibonacci hashing
+    return (id * 2654435769u) >> 22;
+}
+
+// 확장 ID 가 있는 칸 또는 넣을 빈 칸 (선형 탐사, 빈 칸의 ext_index 는 0 = 미등록 핸들러)
+static int central_ext_lookup(const central_dispatch_t *dispatch, uint32_t id)
+{
+    uint32_t slot = central_ext_hash(id) & (CENTRAL_DISPATCH_EXT_CAPACITY - 1);
+
+    while (dispatch->ext_keys[slot] != 0 && dispatch->ext_keys[slot] != id + 1)
+    {
+        slot = (slot + 1) & (CENTRAL_DISPATCH_EXT_CAPACITY - 1);
+    }
+    return (int)slot;
+}
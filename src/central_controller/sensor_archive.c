@@ -0,0 +1,372 @@
+#include "include/sensor_archive.h"
+#include <string.h>
+#include <stddef.h>
+
+#define SENSOR_ARCHIVE_STATUS_FLAG 0x01   // 상태가 바뀜 (1바이트 뒤따름)
+#define SENSOR_ARCHIVE_SEQUENCE_FLAG 0x02 // 시퀀스가 이어지지 않음 (2바이트 뒤따름)
+
+static const uint64_t g_rollup_width_ns[SENSOR_ROLLUP_TIERS] = {1000000000ull, 60000000000ull, 3600000000000ull};
+static const uint32_t g_rollup_default[SENSOR_ROLLUP_TIERS] = {SENSOR_ROLLUP_DEFAULT_1S, SENSOR_ROLLUP_DEFAULT_1M, SENSOR_ROLLUP_DEFAULT_1H};
+
+static sensor_archive_block_t *sensor_archive_open_block(sensor_archive_t *archive, uint64_t tick);
+static int sensor_archive_decode(const sensor_archive_block_t *block, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max);
+static void sensor_rollup_add(sensor_rollup_t *rollup, uint64_t timestamp_ns, int16_t value);
+static uint32_t sensor_archive_put_varint(uint8_t *out, uint64_t value);
+static uint64_t sensor_archive_get_varint(const uint8_t *in, uint32_t *pos);
+static uint64_t sensor_archive_zigzag(int64_t value);
+static int64_t sensor_archive_unzigzag(uint64_t value);
+
+bool sensor_archive_init(sensor_archive_t *archive, const sensor_archive_config_t *config)
+{
+    if (!archive)
+    {
+        return false;
+    }
+
+    memset(archive, 0, sizeof(sensor_archive_t));
+    uint32_t blocks = config && config->blocks ? config->blocks : SENSOR_ARCHIVE_DEFAULT_BLOCKS;
+    if (blocks > (1u << 24))
+    {
+        return false;
+    }
+
+    archive->capacity = can_next_pow2(blocks);
+    archive->mask = archive->capacity - 1;
+    archive->blocks = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(sensor_archive_block_t) * archive->capacity);
+    if (!archive->blocks)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < SENSOR_ROLLUP_TIERS; i++)
+    {
+        sensor_rollup_t *rollup = &archive->rollup[i];
+        uint32_t buckets = config && config->rollup_buckets[i] ? config->rollup_buckets[i] : g_rollup_default[i];
+
+        rollup->width_ns = g_rollup_width_ns[i];
+        rollup->capacity = buckets > (1u << 24) ? 0 : can_next_pow2(buckets);
+        rollup->mask = rollup->capacity - 1;
+        rollup->buckets = rollup->capacity ? can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(sensor_rollup_bucket_t) * rollup->capacity) : NULL;
+        if (!rollup->buckets)
+        {
+            sensor_archive_free(archive);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void sensor_archive_free(sensor_archive_t *archive)
+{
+    if (!archive)
+    {
+        return;
+    }
+
+    can_aligned_free(archive->blocks);
+    for (int i = 0; i < SENSOR_ROLLUP_TIERS; i++)
+    {
+        can_aligned_free(archive->rollup[i].buckets);
+    }
+    memset(archive, 0, sizeof(sensor_archive_t));
+}
+
+// 샘플 추가 (시각은 단조 증가, 블록이 차면 새 블록을 열고 롤업 구간을 갱신)
+void sensor_archive_append(sensor_archive_t *archive, uint64_t timestamp_ns, const sensor_data_msg_t *msg)
+{
+    uint64_t tick = timestamp_ns / SENSOR_ARCHIVE_TICK_NS;
+    sensor_archive_block_t *block = archive->written ? &archive->blocks[(archive->written - 1) & archive->mask] : NULL;
+
+    if (!block || block->used + SENSOR_ARCHIVE_MAX_SAMPLE_BYTES > SENSOR_ARCHIVE_BLOCK_BYTES || block->cnt == UINT16_MAX)
+    {
+        block = sensor_archive_open_block(archive, tick);
+    }
+
+    // 시각: 직전 간격과의 차이, 값: 직전 값과의 차이 (하위 2비트에 상태/시퀀스 플래그)
+    int64_t delta = (int64_t)(tick - archive->prev_tick);
+    uint8_t flags = 0;
+    if (msg->status != archive->prev_status)
+    {
+        flags |= SENSOR_ARCHIVE_STATUS_FLAG;
+    }
+    if (msg->sequence != (uint16_t)(archive->prev_sequence + 1))
+    {
+        flags |= SENSOR_ARCHIVE_SEQUENCE_FLAG;
+    }
+
+    uint8_t *out = block->data + block->used;
+    uint32_t len = sensor_archive_put_varint(out, sensor_archive_zigzag(delta - archive->prev_delta));
+    len += sensor_archive_put_varint(out + len, (sensor_archive_zigzag((int32_t)msg->value - archive->prev_value) << 2) | flags);
+    if (flags & SENSOR_ARCHIVE_STATUS_FLAG)
+    {
+        out[len++] = msg->status;
+    }
+    if (flags & SENSOR_ARCHIVE_SEQUENCE_FLAG)
+    {
+        out[len++] = (uint8_t)(msg->sequence & 0xFF);
+        out[len++] = (uint8_t)(msg->sequence >> 8);
+    }
+
+    block->used += (uint16_t)len;
+    block->cnt++;
+    block->last_tick = tick;
+    block->min = msg->value < block->min ? msg->value : block->min;
+    block->max = msg->value > block->max ? msg->value : block->max;
+
+    archive->prev_tick = tick;
+    archive->prev_delta = delta;
+    archive->prev_value = msg->value;
+    archive->prev_status = msg->status;
+    archive->prev_sequence = msg->sequence;
+    archive->sample_cnt++;
+
+    for (int i = 0; i < SENSOR_ROLLUP_TIERS; i++)
+    {
+        sensor_rollup_add(&archive->rollup[i], timestamp_ns, msg->value);
+    }
+}
+
+// [t0_ns, t1_ns) 구간 샘플을 시간순으로 최대 max 개 복사 (겹치는 블록만 풀어서 읽음, 복사한 수 반환)
+int sensor_archive_query(const sensor_archive_t *archive, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max)
+{
+    if (!archive || !samples || max <= 0 || t0_ns >= t1_ns || archive->written == 0)
+    {
+        return 0;
+    }
+
+    // 마지막 샘플이 t0 이후인 첫 블록을 이진 탐색
+    uint64_t lo = archive->written > archive->capacity ? archive->written - archive->capacity : 0;
+    uint64_t hi = archive->written;
+    while (lo < hi)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if ((archive->blocks[mid & archive->mask].last_tick + 1) * SENSOR_ARCHIVE_TICK_NS <= t0_ns)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    int n = 0;
+    for (uint64_t i = lo; i < archive->written && n < max; i++)
+    {
+        const sensor_archive_block_t *block = &archive->blocks[i & archive->mask];
+        if (block->first_tick * SENSOR_ARCHIVE_TICK_NS >= t1_ns)
+        {
+            break;
+        }
+        n += sensor_archive_decode(block, t0_ns, t1_ns, samples + n, max - n);
+    }
+
+    return n;
+}
+
+// [t0_ns, t1_ns) 와 겹치는 롤업 구간을 시간순으로 최대 max 개 복사 (채우는 중인 구간 포함)
+int sensor_archive_rollup(const sensor_archive_t *archive, sensor_rollup_tier_t tier, uint64_t t0_ns, uint64_t t1_ns,
+                          sensor_rollup_bucket_t *buckets, int max)
+{
+    if (!archive || tier >= SENSOR_ROLLUP_TIERS || !buckets || max <= 0 || t0_ns >= t1_ns)
+    {
+        return 0;
+    }
+
+    const sensor_rollup_t *rollup = &archive->rollup[tier];
+    uint64_t lo = rollup->written > rollup->capacity ? rollup->written - rollup->capacity : 0;
+    uint64_t hi = rollup->written;
+    while (lo < hi)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (rollup->buckets[mid & rollup->mask].start_ns + rollup->width_ns <= t0_ns)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    int n = 0;
+    for (uint64_t i = lo; i < rollup->written && n < max; i++)
+    {
+        const sensor_rollup_bucket_t *bucket = &rollup->buckets[i & rollup->mask];
+        if (bucket->start_ns >= t1_ns)
+        {
+            return n;
+        }
+        buckets[n++] = *bucket;
+    }
+
+    if (n < max && rollup->open.cnt > 0 && rollup->open.start_ns < t1_ns && rollup->open.start_ns + rollup->width_ns > t0_ns)
+    {
+        buckets[n++] = rollup->open;
+    }
+
+    return n;
+}
+
+// 보관 중인 블록 기준 샘플당 평균 바이트 수 (블록 헤더 포함)
+double sensor_archive_bytes_per_sample(const sensor_archive_t *archive)
+{
+    if (!archive || archive->written == 0)
+    {
+        return 0.0;
+    }
+
+    uint64_t bytes = 0;
+    uint64_t cnt = 0;
+    uint64_t first = archive->written > archive->capacity ? archive->written - archive->capacity : 0;
+    for (uint64_t i = first; i < archive->written; i++)
+    {
+        const sensor_archive_block_t *block = &archive->blocks[i & archive->mask];
+        bytes += block->used + offsetof(sensor_archive_block_t, data);
+        cnt += block->cnt;
+    }
+
+    return cnt ? (double)bytes / (double)cnt : 0.0;
+}
+
+// ------------- static method -------------
+// 새 블록을 열고 인코더 상태를 블록 시작 상태로 되돌림 (디코더도 같은 상태에서 시작)
+static sensor_archive_block_t *sensor_archive_open_block(sensor_archive_t *archive, uint64_t tick)
+{
+    if (archive->written >= archive->capacity)
+    {
+        archive->dropped_blocks++;
+    }
+
+    sensor_archive_block_t *block = &archive->blocks[archive->written & archive->mask];
+    block->first_tick = tick;
+    block->last_tick = tick;
+    block->min = INT16_MAX;
+    block->max = INT16_MIN;
+    block->cnt = 0;
+    block->used = 0;
+    archive->written++;
+
+    archive->prev_tick = tick;
+    archive->prev_delta = 0;
+    archive->prev_value = 0;
+    archive->prev_status = SENSOR_OK;
+    archive->prev_sequence = UINT16_MAX;
+    return block;
+}
+
+static int sensor_archive_decode(const sensor_archive_block_t *block, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max)
+{
+    uint64_t tick = block->first_tick;
+    int64_t delta = 0;
+    int16_t value = 0;
+    uint8_t status = SENSOR_OK;
+    uint16_t sequence = UINT16_MAX;
+    uint32_t pos = 0;
+    int n = 0;
+
+    for (uint16_t i = 0; i < block->cnt && n < max; i++)
+    {
+        delta += sensor_archive_unzigzag(sensor_archive_get_varint(block->data, &pos));
+        tick += (uint64_t)delta;
+
+        uint64_t token = sensor_archive_get_varint(block->data, &pos);
+        value = (int16_t)(value + sensor_archive_unzigzag(token >> 2));
+        sequence++;
+        if (token & SENSOR_ARCHIVE_STATUS_FLAG)
+        {
+            status = block->data[pos++];
+        }
+        if (token & SENSOR_ARCHIVE_SEQUENCE_FLAG)
+        {
+            sequence = (uint16_t)(block->data[pos] | (block->data[pos + 1] << 8));
+            pos += 2;
+        }
+
+        uint64_t timestamp_ns = tick * SENSOR_ARCHIVE_TICK_NS;
+        if (timestamp_ns >= t1_ns)
+        {
+            break;
+        }
+        if (timestamp_ns < t0_ns)
+        {
+            continue;
+        }
+
+        samples[n].timestamp_ns = timestamp_ns;
+        samples[n].value = value;
+        samples[n].status = status;
+        samples[n].sequence = sequence;
+        n++;
+    }
+
+    return n;
+}
+
+// 샘플이 속한 구간에 누적 (구간이 바뀌면 채우던 구간을 링에 넣음)
+static void sensor_rollup_add(sensor_rollup_t *rollup, uint64_t timestamp_ns, int16_t value)
+{
+    uint64_t start_ns = timestamp_ns - timestamp_ns % rollup->width_ns;
+    sensor_rollup_bucket_t *open = &rollup->open;
+
+    if (open->cnt > 0 && open->start_ns != start_ns)
+    {
+        rollup->buckets[rollup->written & rollup->mask] = *open;
+        rollup->written++;
+        open->cnt = 0;
+    }
+
+    if (open->cnt == 0)
+    {
+        open->start_ns = start_ns;
+        open->sum = 0;
+        open->min = value;
+        open->max = value;
+    }
+
+    open->sum += value;
+    open->cnt++;
+    open->min = value < open->min ? value : open->min;
+    open->max = value > open->max ? value : open->max;
+}
+
+// LEB128 (7비트씩, 최상위 비트: 다음 바이트 있음)
+static uint32_t sensor_archive_put_varint(uint8_t *out, uint64_t value)
+{
+    uint32_t len = 0;
+    while (value >= 0x80)
+    {
+        out[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+static uint64_t sensor_archive_get_varint(const uint8_t *in, uint32_t *pos)
+{
+    uint64_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+
+    do
+    {
+        byte = in[(*pos)++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while ((byte & 0x80) && shift < 64);
+
+    return value;
+}
+
+// 부호 있는 차분을 작은 양수로 (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+static uint64_t sensor_archive_zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t sensor_archive_unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
@@ -0,0 +1,116 @@
+#include "include/sensor_history.h"
+#include "../common/include/can_clock.h"
+#include <string.h>
+
+static void *sensor_history_alloc_column(uint32_t depth, size_t elem_size);
+
+bool sensor_history_init(sensor_history_t *history, uint32_t depth)
+{
+    if (!history || depth == 0 || depth > (1u << 30))
+    {
+        return false;
+    }
+
+    memset(history, 0, sizeof(sensor_history_t));
+    history->depth = can_next_pow2(depth);
+    history->mask = history->depth - 1;
+
+    history->timestamp_ns = sensor_history_alloc_column(history->depth, sizeof(uint64_t));
+    history->value = sensor_history_alloc_column(history->depth, sizeof(int16_t));
+    history->status = sensor_history_alloc_column(history->depth, sizeof(uint8_t));
+    history->sequence = sensor_history_alloc_column(history->depth, sizeof(uint16_t));
+
+    if (!history->timestamp_ns || !history->value || !history->status || !history->sequence)
+    {
+        sensor_history_free(history);
+        return false;
+    }
+
+    return true;
+}
+
+void sensor_history_free(sensor_history_t *history)
+{
+    if (!history)
+    {
+        return;
+    }
+
+    can_aligned_free(history->timestamp_ns);
+    can_aligned_free(history->value);
+    can_aligned_free(history->status);
+    can_aligned_free(history->sequence);
+    memset(history, 0, sizeof(sensor_history_t));
+}
+
+void sensor_history_append(sensor_history_t *history, uint64_t timestamp_ns, const sensor_data_msg_t *msg)
+{
+    uint32_t idx = (uint32_t)(history->head & history->mask);
+
+    history->timestamp_ns[idx] = timestamp_ns;
+    history->value[idx] = msg->value;
+    history->status[idx] = msg->status;
+    history->sequence[idx] = msg->sequence;
+
+    history->head++;
+    if (history->cnt < history->depth)
+    {
+        history->cnt++;
+    }
+    history->last_update = can_clock_wall_time();
+}
+
+// 최근 n개(저장된 수보다 많으면 전체) 샘플의 구간 계산, 오래된 것부터 순서대로
+uint32_t sensor_history_window(const sensor_history_t *history, uint32_t n, sensor_history_span_t *span)
+{
+    memset(span, 0, sizeof(sensor_history_span_t));
+
+    if (n > history->cnt)
+    {
+        n = history->cnt;
+    }
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    uint32_t first = (uint32_t)((history->head - n) & history->mask);
+    uint32_t until_end = history->depth - first;
+
+    span->start[0] = first;
+    span->len[0] = n < until_end ? n : until_end;
+    span->start[1] = 0;
+    span->len[1] = n - span->len[0];
+
+    return n;
+}
+
+// age 번째 이전 샘플 (0: 가장 최근)
+bool sensor_history_get(const sensor_history_t *history, uint32_t age, sensor_sample_t *sample)
+{
+    if (age >= history->cnt)
+    {
+        return false;
+    }
+
+    uint32_t idx = (uint32_t)((history->head - 1 - age) & history->mask);
+    sample->timestamp_ns = history->timestamp_ns[idx];
+    sample->value = history->value[idx];
+    sample->status = history->status[idx];
+    sample->sequence = history->sequence[idx];
+    return true;
+}
+
+// ------------- static method -------------
+static void *sensor_history_alloc_column(uint32_t depth, size_t elem_size)
+{
+    size_t size = (size_t)depth * elem_size;
+    size = (size + CAN_CACHELINE_SIZE - 1) & ~(size_t)(CAN_CACHELINE_SIZE - 1);
+
+    void *column = can_aligned_alloc(CAN_CACHELINE_SIZE, size);
+    if (column)
+    {
+        memset(column, 0, size);
+    }
+    return column;
+}
@@ -0,0 +1,86 @@
+#include "include/sensor_liveness.h"
+#include <string.h>
+
+static uint64_t sensor_liveness_tick(const sensor_liveness_t *liveness, uint64_t now_ns);
+static void sensor_liveness_expire(void *ctx, uint32_t timer_id, uint64_t expiry_tick);
+
+bool sensor_liveness_init(sensor_liveness_t *liveness, uint32_t timeout_ms, uint64_t now_ns)
+{
+    if (!liveness || timeout_ms == 0)
+    {
+        return false;
+    }
+
+    memset(liveness, 0, sizeof(sensor_liveness_t));
+    if (!can_timer_wheel_init(&liveness->wheel, SENSOR_LIVENESS_SENSORS, 0))
+    {
+        return false;
+    }
+
+    liveness->start_ns = now_ns;
+    liveness->timeout_ms = timeout_ms;
+    return true;
+}
+
+void sensor_liveness_free(sensor_liveness_t *liveness)
+{
+    if (!liveness)
+    {
+        return;
+    }
+
+    can_timer_wheel_free(&liveness->wheel);
+    memset(liveness, 0, sizeof(sensor_liveness_t));
+}
+
+// 데이터 또는 하트비트 수신 시 마감을 now + timeout 으로 다시 걸기 (O(1))
+void sensor_liveness_touch(sensor_liveness_t *liveness, uint8_t sensor_id, uint64_t now_ns)
+{
+    uint64_t tick = sensor_liveness_tick(liveness, now_ns);
+    liveness->last_seen_ns[sensor_id] = now_ns;
+
+    if (!liveness->seen[sensor_id] || liveness->status[sensor_id] == SENSOR_OFFLINE)
+    {
+        liveness->seen[sensor_id] = true;
+        liveness->status[sensor_id] = SENSOR_OK;
+        liveness->online_cnt++;
+        if (liveness->on_change)
+        {
+            liveness->on_change(liveness->ctx, sensor_id, SENSOR_OK, now_ns);
+        }
+    }
+
+    can_timer_wheel_arm(&liveness->wheel, sensor_id, tick + liveness->timeout_ms);
+}
+
+// now_ns 까지 마감이 지난 센서를 SENSOR_OFFLINE 으로 표시 (새로 오프라인이 된 센서 수 반환)
+uint32_t sensor_liveness_poll(sensor_liveness_t *liveness, uint64_t now_ns)
+{
+    return can_timer_wheel_advance(&liveness->wheel, sensor_liveness_tick(liveness, now_ns), sensor_liveness_expire, liveness);
+}
+
+uint8_t sensor_liveness_status(const sensor_liveness_t *liveness, uint8_t sensor_id)
+{
+    return liveness->seen[sensor_id] ? liveness->status[sensor_id] : SENSOR_OFFLINE;
+}
+
+// ------------- static method -------------
+static uint64_t sensor_liveness_tick(const sensor_liveness_t *liveness, uint64_t now_ns)
+{
+    return now_ns > liveness->start_ns ? (now_ns - liveness->start_ns) / SENSOR_LIVENESS_TICK_NS : 0;
+}
+
+static void sensor_liveness_expire(void *ctx, uint32_t timer_id, uint64_t expiry_tick)
+{
+    sensor_liveness_t *liveness = ctx;
+    uint8_t sensor_id = (uint8_t)timer_id;
+    (void)expiry_tick;
+
+    liveness->status[sensor_id] = SENSOR_OFFLINE;
+    liveness->online_cnt--;
+    liveness->offline_events++;
+    if (liveness->on_change)
+    {
+        liveness->on_change(liveness->ctx, sensor_id, SENSOR_OFFLINE, liveness->last_seen_ns[sensor_id]);
+    }
+}
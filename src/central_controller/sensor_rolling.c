@@ -0,0 +1,155 @@
+#include "include/sensor_rolling.h"
+#include "../common/include/message_type.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+static int16_t sensor_deque_value(const sensor_rolling_t *rolling, uint64_t index);
+static void sensor_deque_push(sensor_deque_t *deque, const sensor_rolling_t *rolling, uint64_t index, bool keep_min);
+static void sensor_deque_expire(sensor_deque_t *deque, const sensor_rolling_t *rolling, uint64_t oldest);
+static int16_t sensor_deque_front(const sensor_deque_t *deque, const sensor_rolling_t *rolling);
+
+bool sensor_rolling_init(sensor_rolling_t *rolling, uint32_t window, double ewma_alpha)
+{
+    if (!rolling || window == 0 || ewma_alpha <= 0.0 || ewma_alpha > 1.0)
+    {
+        return false;
+    }
+
+    memset(rolling, 0, sizeof(sensor_rolling_t));
+    rolling->window = window;
+    rolling->ewma_alpha = ewma_alpha;
+    rolling->values = calloc(window, sizeof(int16_t));
+    rolling->min_deque.index = calloc(window, sizeof(uint64_t));
+    rolling->max_deque.index = calloc(window, sizeof(uint64_t));
+
+    if (!rolling->values || !rolling->min_deque.index || !rolling->max_deque.index)
+    {
+        sensor_rolling_free(rolling);
+        return false;
+    }
+
+    return true;
+}
+
+void sensor_rolling_free(sensor_rolling_t *rolling)
+{
+    if (!rolling)
+    {
+        return;
+    }
+
+    free(rolling->values);
+    free(rolling->min_deque.index);
+    free(rolling->max_deque.index);
+    memset(rolling, 0, sizeof(sensor_rolling_t));
+}
+
+void sensor_rolling_update(sensor_rolling_t *rolling, int16_t value)
+{
+    uint64_t index = rolling->total;
+    uint32_t slot = (uint32_t)(index % rolling->window);
+
+    // 윈도우가 가득 찼으면 가장 오래된 값을 합계에서 제거
+    if (rolling->cnt == rolling->window)
+    {
+        int32_t old = rolling->values[slot];
+        rolling->sum -= old;
+        rolling->sum_sq -= (uint64_t)(old * old);
+    }
+    else
+    {
+        rolling->cnt++;
+    }
+
+    rolling->values[slot] = value;
+    rolling->sum += value;
+    rolling->sum_sq += (uint64_t)((int32_t)value * value);
+    rolling->total++;
+
+    // 윈도우를 벗어난 min/max 후보 제거 후 새 값 추가
+    uint64_t oldest = rolling->total - rolling->cnt;
+    sensor_deque_expire(&rolling->min_deque, rolling, oldest);
+    sensor_deque_expire(&rolling->max_deque, rolling, oldest);
+    sensor_deque_push(&rolling->min_deque, rolling, index, true);
+    sensor_deque_push(&rolling->max_deque, rolling, index, false);
+
+    // Welford (전체 기간)
+    double delta = value - rolling->welford_mean;
+    rolling->welford_mean += delta / (double)rolling->total;
+    rolling->welford_m2 += delta * (value - rolling->welford_mean);
+
+    // EWMA
+    if (rolling->total == 1)
+    {
+        rolling->ewma = value;
+    }
+    else
+    {
+        rolling->ewma += rolling->ewma_alpha * (value - rolling->ewma);
+    }
+}
+
+void sensor_rolling_snapshot(const sensor_rolling_t *rolling, sensor_rolling_stats_t *stats)
+{
+    memset(stats, 0, sizeof(sensor_rolling_stats_t));
+    if (rolling->cnt == 0)
+    {
+        return;
+    }
+
+    // 윈도우 통계는 sensor_stats 와 같은 방식으로 마무리
+    sensor_stats_acc_t acc;
+    acc.count = rolling->cnt;
+    acc.min = sensor_deque_front(&rolling->min_deque, rolling);
+    acc.max = sensor_deque_front(&rolling->max_deque, rolling);
+    acc.sum = rolling->sum;
+    acc.sum_sq = rolling->sum_sq;
+    sensor_stats_finalize(&acc, &stats->window);
+
+    stats->ewma = rolling->ewma / SENSOR_VALUE_SCALE;
+    stats->lifetime_cnt = rolling->total;
+    stats->lifetime_mean = rolling->welford_mean / SENSOR_VALUE_SCALE;
+    stats->lifetime_stddev = sqrt(rolling->welford_m2 / (double)rolling->total) / SENSOR_VALUE_SCALE;
+}
+
+// ------------- static method -------------
+static int16_t sensor_deque_value(const sensor_rolling_t *rolling, uint64_t index)
+{
+    return rolling->values[index % rolling->window];
+}
+
+// 새 값보다 불리한 후보를 뒤에서 제거한 뒤 추가 (분할 상환 O(1))
+static void sensor_deque_push(sensor_deque_t *deque, const sensor_rolling_t *rolling, uint64_t index, bool keep_min)
+{
+    int16_t value = sensor_deque_value(rolling, index);
+
+    while (deque->len > 0)
+    {
+        uint32_t back = (deque->head + deque->len - 1) % rolling->window;
+        int16_t back_value = sensor_deque_value(rolling, deque->index[back]);
+
+        if (keep_min ? back_value < value : back_value > value)
+        {
+            break;
+        }
+        deque->len--;
+    }
+
+    deque->index[(deque->head + deque->len) % rolling->window] = index;
+    deque->len++;
+}
+
+static void sensor_deque_expire(sensor_deque_t *deque, const sensor_rolling_t *rolling, uint64_t oldest)
+{
+    while (deque->len > 0 && deque->index[deque->head] < oldest)
+    {
+        deque->head = (deque->head + 1) % rolling->window;
+        deque->len--;
+    }
+}
+
+static int16_t sensor_deque_front(const sensor_deque_t *deque, const sensor_rolling_t *rolling)
+{
+    return sensor_deque_value(rolling, deque->index[deque->head]);
+}
@@ -0,0 +1,110 @@
+#include "include/sensor_sequence.h"
+#include <string.h>
+
+static void sensor_sequence_restart(sensor_sequence_t *sequence, uint16_t number);
+
+void sensor_sequence_reset(sensor_sequence_t *sequence)
+{
+    if (!sequence)
+    {
+        return;
+    }
+
+    memset(sequence, 0, sizeof(sensor_sequence_t));
+}
+
+// 프레임 하나를 분류하고 통계 갱신 (O(1))
+sensor_seq_class_t sensor_sequence_observe(sensor_sequence_t *sequence, uint16_t number)
+{
+    sensor_sequence_stats_t *stats = &sequence->stats;
+    stats->received++;
+
+    if (!sequence->started)
+    {
+        sensor_sequence_restart(sequence, number);
+        stats->in_order++;
+        return SENSOR_SEQ_IN_ORDER;
+    }
+
+    // 순환을 고려한 거리 (반 바퀴 이내는 앞, 그 밖은 뒤)
+    int32_t delta = (int16_t)(uint16_t)(number - sequence->highest);
+
+    if (delta > 0)
+    {
+        sequence->stale_run = 0;
+        sequence->window = delta >= SENSOR_SEQUENCE_WINDOW ? 1 : (sequence->window << delta) | 1;
+        sequence->highest = number;
+        stats->expected += (uint64_t)delta;
+
+        if (delta == 1)
+        {
+            stats->in_order++;
+            return SENSOR_SEQ_IN_ORDER;
+        }
+
+        stats->gaps++;
+        stats->lost += (uint64_t)(delta - 1);
+        return SENSOR_SEQ_GAP;
+    }
+
+    uint32_t offset = (uint32_t)-delta;
+    if (offset < SENSOR_SEQUENCE_WINDOW)
+    {
+        sequence->stale_run = 0;
+        uint64_t bit = 1ull << offset;
+        if (sequence->window & bit)
+        {
+            stats->duplicate++;
+            return SENSOR_SEQ_DUPLICATE;
+        }
+
+        sequence->window |= bit;
+        stats->late++;
+        if (stats->lost > 0)
+        {
+            stats->lost--;
+        }
+        return SENSOR_SEQ_LATE;
+    }
+
+    // 창보다 오래된 번호: 중복인지 알 수 없으므로 늦은 프레임으로만 계산, 계속 이어지면 재시작으로 봄
+    if (++sequence->stale_run >= SENSOR_SEQUENCE_RESYNC)
+    {
+        stats->resync++;
+        sensor_sequence_restart(sequence, number);
+        stats->in_order++;
+        return SENSOR_SEQ_IN_ORDER;
+    }
+
+    stats->late++;
+    return SENSOR_SEQ_LATE;
+}
+
+void sensor_sequence_accumulate(sensor_sequence_stats_t *total, const sensor_sequence_stats_t *stats)
+{
+    total->expected += stats->expected;
+    total->received += stats->received;
+    total->in_order += stats->in_order;
+    total->gaps += stats->gaps;
+    total->late += stats->late;
+    total->duplicate += stats->duplicate;
+    total->lost += stats->lost;
+    total->resync += stats->resync;
+}
+
+// 손실률 (아직 받지 못한 번호 / 받았어야 할 프레임 수)
+double sensor_sequence_loss_rate(const sensor_sequence_stats_t *stats)
+{
+    return stats->expected ? (double)stats->lost / (double)stats->expected : 0.0;
+}
+
+// ------------- static method -------------
+// number 를 첫 프레임으로 다시 시작 (최고 번호와 비트맵만 초기화, 통계는 유지)
+static void sensor_sequence_restart(sensor_sequence_t *sequence, uint16_t number)
+{
+    sequence->started = true;
+    sequence->stale_run = 0;
+    sequence->highest = number;
+    sequence->window = 1;
+    sequence->stats.expected++;
+}
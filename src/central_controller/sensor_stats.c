@@ -0,0 +1,416 @@
+#include "include/sensor_stats.h"
+#include "../common/include/message_type.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <math.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SENSOR_STATS_X86 1
+#include <immintrin.h>
+#else
+#define SENSOR_STATS_X86 0
+#endif
+
+// int32 부분합, int16 레인 카운터 넘침 방지를 위한 블록 크기 (반복 횟수)
+#define SENSOR_STATS_BLOCK_ITERS 16384
+
+typedef void (*sensor_accumulate_fn)(sensor_stats_acc_t *acc, const int16_t *values, size_t n);
+typedef void (*sensor_scan_fn)(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold);
+
+// 커널 묶음 (함께 바뀌도록 포인터 하나로 교체)
+typedef struct
+{
+    sensor_kernel_t kind;
+    sensor_accumulate_fn accumulate;
+    sensor_scan_fn scan;
+} sensor_stats_kernels_t;
+
+static void sensor_accumulate_scalar(sensor_stats_acc_t *acc, const int16_t *values, size_t n);
+static void sensor_scan_scalar(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold);
+#if SENSOR_STATS_X86
+static void sensor_accumulate_sse2(sensor_stats_acc_t *acc, const int16_t *values, size_t n);
+static void sensor_scan_sse2(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold);
+static void sensor_accumulate_avx2(sensor_stats_acc_t *acc, const int16_t *values, size_t n);
+static void sensor_scan_avx2(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold);
+#endif
+
+static const sensor_stats_kernels_t g_scalar_kernels = {SENSOR_KERNEL_SCALAR, sensor_accumulate_scalar, sensor_scan_scalar};
+#if SENSOR_STATS_X86
+static const sensor_stats_kernels_t g_sse2_kernels = {SENSOR_KERNEL_SSE2, sensor_accumulate_sse2, sensor_scan_sse2};
+static const sensor_stats_kernels_t g_avx2_kernels = {SENSOR_KERNEL_AVX2, sensor_accumulate_avx2, sensor_scan_avx2};
+#endif
+
+static _Atomic(const sensor_stats_kernels_t *) g_kernels = NULL;
+static pthread_once_t g_kernel_once = PTHREAD_ONCE_INIT;
+
+static const sensor_stats_kernels_t *sensor_stats_kernels(void);
+static void sensor_stats_detect_kernel(void);
+
+void sensor_stats_acc_init(sensor_stats_acc_t *acc)
+{
+    memset(acc, 0, sizeof(sensor_stats_acc_t));
+    acc->min = INT16_MAX;
+    acc->max = INT16_MIN;
+}
+
+// 구간을 누적값에 더함 (링 버퍼의 두 구간을 차례로 넣을 수 있음)
+void sensor_stats_accumulate(sensor_stats_acc_t *acc, const int16_t *values, size_t n)
+{
+    if (!acc || !values || n == 0)
+    {
+        return;
+    }
+
+    sensor_stats_kernels()->accumulate(acc, values, n);
+}
+
+void sensor_stats_finalize(const sensor_stats_acc_t *acc, sensor_stats_t *stats)
+{
+    memset(stats, 0, sizeof(sensor_stats_t));
+    stats->count = acc->count;
+    if (acc->count == 0)
+    {
+        return;
+    }
+
+    double n = (double)acc->count;
+    double mean_raw = (double)acc->sum / n;
+    double mean_sq_raw = (double)acc->sum_sq / n;
+    double var_raw = mean_sq_raw - mean_raw * mean_raw;
+
+    stats->min = acc->min;
+    stats->max = acc->max;
+    stats->mean = mean_raw / SENSOR_VALUE_SCALE;
+    stats->stddev = (var_raw > 0 ? sqrt(var_raw) : 0.0) / SENSOR_VALUE_SCALE;
+    stats->rms = sqrt(mean_sq_raw) / SENSOR_VALUE_SCALE;
+}
+
+// 경고/에러 구간에 들어간 샘플 수를 결과에 더함
+void sensor_stats_scan(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold)
+{
+    if (!result || !values || !threshold || n == 0)
+    {
+        return;
+    }
+
+    sensor_stats_kernels()->scan(result, values, n, threshold);
+}
+
+sensor_kernel_t sensor_stats_kernel(void)
+{
+    return sensor_stats_kernels()->kind;
+}
+
+// 커널 강제 지정 (CPU 가 지원하지 않으면 무시, 성능 비교용, 계산 중인 스레드는 다음 호출부터 사용)
+void sensor_stats_force_kernel(sensor_kernel_t kernel)
+{
+    pthread_once(&g_kernel_once, sensor_stats_detect_kernel);
+
+    switch (kernel)
+    {
+#if SENSOR_STATS_X86
+    case SENSOR_KERNEL_AVX2:
+        if (__builtin_cpu_supports("avx2"))
+        {
+            atomic_store_explicit(&g_kernels, &g_avx2_kernels, memory_order_release);
+        }
+        break;
+    case SENSOR_KERNEL_SSE2:
+        if (__builtin_cpu_supports("sse2"))
+        {
+            atomic_store_explicit(&g_kernels, &g_sse2_kernels, memory_order_release);
+        }
+        break;
+#endif
+    default:
+        atomic_store_explicit(&g_kernels, &g_scalar_kernels, memory_order_release);
+        break;
+    }
+}
+
+// ------------- static method -------------
+// 사용할 커널 묶음 (처음 호출할 때 한 번만 CPU 를 확인, 여러 스레드가 동시에 불러도 됨)
+static const sensor_stats_kernels_t *sensor_stats_kernels(void)
+{
+    const sensor_stats_kernels_t *kernels = atomic_load_explicit(&g_kernels, memory_order_acquire);
+    if (kernels)
+    {
+        return kernels;
+    }
+
+    pthread_once(&g_kernel_once, sensor_stats_detect_kernel);
+    return atomic_load_explicit(&g_kernels, memory_order_acquire);
+}
+
+static void sensor_stats_detect_kernel(void)
+{
+    const sensor_stats_kernels_t *kernels = &g_scalar_kernels;
+
+#if SENSOR_STATS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        kernels = &g_avx2_kernels;
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        kernels = &g_sse2_kernels;
+    }
+#endif
+    atomic_store_explicit(&g_kernels, kernels, memory_order_release);
+}
+
+static void sensor_accumulate_scalar(sensor_stats_acc_t *acc, const int16_t *values, size_t n)
+{
+    int16_t min = acc->min;
+    int16_t max = acc->max;
+    int64_t sum = 0;
+    uint64_t sum_sq = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t x = values[i];
+        min = x < min ? (int16_t)x : min;
+        max = x > max ? (int16_t)x : max;
+        sum += x;
+        sum_sq += (uint64_t)(x * x);
+    }
+
+    acc->min = min;
+    acc->max = max;
+    acc->sum += sum;
+    acc->sum_sq += sum_sq;
+    acc->count += n;
+}
+
+static void sensor_scan_scalar(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold)
+{
+    uint64_t warning_cnt = 0;
+    uint64_t error_cnt = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        int16_t x = values[i];
+        bool error = x > threshold->error_high || x < threshold->error_low;
+        bool warning = x > threshold->warning_high || x < threshold->warning_low;
+
+        error_cnt += error;
+        warning_cnt += warning && !error;
+    }
+
+    result->warning_cnt += warning_cnt;
+    result->error_cnt += error_cnt;
+}
+
+#if SENSOR_STATS_X86
+// 8개씩: min/max 는 epi16, 합은 madd 로 int32 부분합, 제곱합은 uint32 를 uint64 로 확장하여 누적
+__attribute__((target("sse2"))) static void sensor_accumulate_sse2(sensor_stats_acc_t *acc, const int16_t *values, size_t n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i vmin = _mm_set1_epi16(acc->min);
+    __m128i vmax = _mm_set1_epi16(acc->max);
+    __m128i sum64 = zero;
+    __m128i sq64 = zero;
+    size_t i = 0;
+
+    while (i + 8 <= n)
+    {
+        size_t block_end = i + 8 * (size_t)SENSOR_STATS_BLOCK_ITERS;
+        if (block_end > n)
+        {
+            block_end = n;
+        }
+
+        __m128i sum32 = zero;
+        for (; i + 8 <= block_end; i += 8)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(values + i));
+            vmin = _mm_min_epi16(vmin, x);
+            vmax = _mm_max_epi16(vmax, x);
+            sum32 = _mm_add_epi32(sum32, _mm_madd_epi16(x, ones));
+
+            __m128i sq = _mm_madd_epi16(x, x);
+            sq64 = _mm_add_epi64(sq64, _mm_unpacklo_epi32(sq, zero));
+            sq64 = _mm_add_epi64(sq64, _mm_unpackhi_epi32(sq, zero));
+        }
+
+        // int32 부분합을 부호 확장하여 int64 로 누적
+        __m128i sign = _mm_cmpgt_epi32(zero, sum32);
+        sum64 = _mm_add_epi64(sum64, _mm_unpacklo_epi32(sum32, sign));
+        sum64 = _mm_add_epi64(sum64, _mm_unpackhi_epi32(sum32, sign));
+    }
+
+    int16_t mins[8], maxs[8];
+    int64_t sums[2];
+    uint64_t sqs[2];
+    _mm_storeu_si128((__m128i *)mins, vmin);
+    _mm_storeu_si128((__m128i *)maxs, vmax);
+    _mm_storeu_si128((__m128i *)sums, sum64);
+    _mm_storeu_si128((__m128i *)sqs, sq64);
+
+    for (int k = 0; k < 8; k++)
+    {
+        acc->min = mins[k] < acc->min ? mins[k] : acc->min;
+        acc->max = maxs[k] > acc->max ? maxs[k] : acc->max;
+    }
+    acc->sum += sums[0] + sums[1];
+    acc->sum_sq += sqs[0] + sqs[1];
+    acc->count += i;
+
+    if (i < n)
+    {
+        sensor_accumulate_scalar(acc, values + i, n - i);
+    }
+}
+
+__attribute__((target("sse2"))) static void sensor_scan_sse2(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold)
+{
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i warning_low = _mm_set1_epi16(threshold->warning_low);
+    const __m128i warning_high = _mm_set1_epi16(threshold->warning_high);
+    const __m128i error_low = _mm_set1_epi16(threshold->error_low);
+    const __m128i error_high = _mm_set1_epi16(threshold->error_high);
+    size_t i = 0;
+
+    while (i + 8 <= n)
+    {
+        size_t block_end = i + 8 * (size_t)SENSOR_STATS_BLOCK_ITERS;
+        if (block_end > n)
+        {
+            block_end = n;
+        }
+
+        // 비교 결과(-1)를 빼서 레인별 개수를 셈
+        __m128i warning_cnt = _mm_setzero_si128();
+        __m128i error_cnt = _mm_setzero_si128();
+        for (; i + 8 <= block_end; i += 8)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(values + i));
+            __m128i error = _mm_or_si128(_mm_cmpgt_epi16(x, error_high), _mm_cmplt_epi16(x, error_low));
+            __m128i warning = _mm_or_si128(_mm_cmpgt_epi16(x, warning_high), _mm_cmplt_epi16(x, warning_low));
+            error_cnt = _mm_sub_epi16(error_cnt, error);
+            warning_cnt = _mm_sub_epi16(warning_cnt, _mm_andnot_si128(error, warning));
+        }
+
+        int32_t lanes[4];
+        _mm_storeu_si128((__m128i *)lanes, _mm_madd_epi16(error_cnt, ones));
+        result->error_cnt += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_si128((__m128i *)lanes, _mm_madd_epi16(warning_cnt, ones));
+        result->warning_cnt += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    if (i < n)
+    {
+        sensor_scan_scalar(result, values + i, n - i, threshold);
+    }
+}
+
+// 16개씩 처리하는 AVX2 버전 (구성은 SSE2 와 동일)
+__attribute__((target("avx2"))) static void sensor_accumulate_avx2(sensor_stats_acc_t *acc, const int16_t *values, size_t n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i vmin = _mm256_set1_epi16(acc->min);
+    __m256i vmax = _mm256_set1_epi16(acc->max);
+    __m256i sum64 = zero;
+    __m256i sq64 = zero;
+    size_t i = 0;
+
+    while (i + 16 <= n)
+    {
+        size_t block_end = i + 16 * (size_t)SENSOR_STATS_BLOCK_ITERS;
+        if (block_end > n)
+        {
+            block_end = n;
+        }
+
+        __m256i sum32 = zero;
+        for (; i + 16 <= block_end; i += 16)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(values + i));
+            vmin = _mm256_min_epi16(vmin, x);
+            vmax = _mm256_max_epi16(vmax, x);
+            sum32 = _mm256_add_epi32(sum32, _mm256_madd_epi16(x, ones));
+
+            __m256i sq = _mm256_madd_epi16(x, x);
+            sq64 = _mm256_add_epi64(sq64, _mm256_unpacklo_epi32(sq, zero));
+            sq64 = _mm256_add_epi64(sq64, _mm256_unpackhi_epi32(sq, zero));
+        }
+
+        __m256i sign = _mm256_cmpgt_epi32(zero, sum32);
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpacklo_epi32(sum32, sign));
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpackhi_epi32(sum32, sign));
+    }
+
+    int16_t mins[16], maxs[16];
+    int64_t sums[4];
+    uint64_t sqs[4];
+    _mm256_storeu_si256((__m256i *)mins, vmin);
+    _mm256_storeu_si256((__m256i *)maxs, vmax);
+    _mm256_storeu_si256((__m256i *)sums, sum64);
+    _mm256_storeu_si256((__m256i *)sqs, sq64);
+
+    for (int k = 0; k < 16; k++)
+    {
+        acc->min = mins[k] < acc->min ? mins[k] : acc->min;
+        acc->max = maxs[k] > acc->max ? maxs[k] : acc->max;
+    }
+    acc->sum += sums[0] + sums[1] + sums[2] + sums[3];
+    acc->sum_sq += sqs[0] + sqs[1] + sqs[2] + sqs[3];
+    acc->count += i;
+
+    if (i < n)
+    {
+        sensor_accumulate_scalar(acc, values + i, n - i);
+    }
+}
+
+__attribute__((target("avx2"))) static void sensor_scan_avx2(sensor_scan_result_t *result, const int16_t *values, size_t n, const sensor_threshold_raw_t *threshold)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i warning_low = _mm256_set1_epi16(threshold->warning_low);
+    const __m256i warning_high = _mm256_set1_epi16(threshold->warning_high);
+    const __m256i error_low = _mm256_set1_epi16(threshold->error_low);
+    const __m256i error_high = _mm256_set1_epi16(threshold->error_high);
+    size_t i = 0;
+
+    while (i + 16 <= n)
+    {
+        size_t block_end = i + 16 * (size_t)SENSOR_STATS_BLOCK_ITERS;
+        if (block_end > n)
+        {
+            block_end = n;
+        }
+
+        __m256i warning_cnt = _mm256_setzero_si256();
+        __m256i error_cnt = _mm256_setzero_si256();
+        for (; i + 16 <= block_end; i += 16)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(values + i));
+            __m256i error = _mm256_or_si256(_mm256_cmpgt_epi16(x, error_high), _mm256_cmpgt_epi16(error_low, x));
+            __m256i warning = _mm256_or_si256(_mm256_cmpgt_epi16(x, warning_high), _mm256_cmpgt_epi16(warning_low, x));
+            error_cnt = _mm256_sub_epi16(error_cnt, error);
+            warning_cnt = _mm256_sub_epi16(warning_cnt, _mm256_andnot_si256(error, warning));
+        }
+
+        int32_t lanes[8];
+        _mm256_storeu_si256((__m256i *)lanes, _mm256_madd_epi16(error_cnt, ones));
+        for (int k = 0; k < 8; k++)
+        {
+            result->error_cnt += (uint64_t)lanes[k];
+        }
+        _mm256_storeu_si256((__m256i *)lanes, _mm256_madd_epi16(warning_cnt, ones));
+        for (int k = 0; k < 8; k++)
+        {
+            result->warning_cnt += (uint64_t)lanes[k];
+        }
+    }
+
+    if (i < n)
+    {
+        sensor_scan_scalar(result, values + i, n - i, threshold);
+    }
+}
+#endif
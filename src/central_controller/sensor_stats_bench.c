@@ -0,0 +1,166 @@
+// sensor_stats 커널 비교 (스칼라 / SSE2 / AVX2)
+// 빌드: gcc -O2 -std=gnu11 -o sensor_stats_bench src/central_controller/sensor_stats_bench.c src/central_controller/sensor_stats.c -pthread -lm
+// 실행: ./sensor_stats_bench [샘플 수 (기본 1M)] [반복 수 (기본 50)]
+// 커널마다 같은 데이터를 반복 처리해 가장 빠른 1회 시간을 출력하고, 결과가 스칼라와 같은지 확인
+#include "include/sensor_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_SAMPLES (1u << 20)
+#define BENCH_DEFAULT_ROUNDS 50
+
+// 커널 하나의 측정 결과
+typedef struct
+{
+    sensor_kernel_t kernel;
+    const char *name;
+    bool supported;
+    double accumulate_ms; // 가장 빠른 1회
+    double scan_ms;
+    sensor_stats_acc_t acc;
+    sensor_scan_result_t scan;
+} bench_result_t;
+
+static uint64_t bench_now_ns(void);
+static void bench_fill(int16_t *values, size_t n);
+static void bench_run(bench_result_t *result, const int16_t *values, size_t n, int rounds, const sensor_threshold_raw_t *threshold);
+static bool bench_same(const bench_result_t *a, const bench_result_t *b);
+
+int main(int argc, char *argv[])
+{
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 0) : BENCH_DEFAULT_SAMPLES;
+    int rounds = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_ROUNDS;
+    if (n == 0 || rounds <= 0)
+    {
+        fprintf(stderr, "usage: %s [samples] [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    int16_t *values = malloc(n * sizeof(int16_t));
+    if (!values)
+    {
+        fprintf(stderr, "[BENCH] %zu 샘플 할당 실패\n", n);
+        return 1;
+    }
+    bench_fill(values, n);
+
+    // 온도 센서 기준 (0.01 단위 전송값): 경고 -10~60도 밖, 에러 -30~85도 밖
+    sensor_threshold_raw_t threshold = {
+        .warning_low = -1000,
+        .warning_high = 6000,
+        .error_low = -3000,
+        .error_high = 8500};
+
+    bench_result_t results[] = {
+        {.kernel = SENSOR_KERNEL_SCALAR, .name = "scalar"},
+        {.kernel = SENSOR_KERNEL_SSE2, .name = "SSE2"},
+        {.kernel = SENSOR_KERNEL_AVX2, .name = "AVX2"}};
+    int result_cnt = (int)(sizeof(results) / sizeof(results[0]));
+
+    printf("[BENCH] samples=%zu rounds=%d\n", n, rounds);
+    printf("%-8s %14s %14s %10s\n", "kernel", "accumulate ms", "scan ms", "result");
+
+    int mismatch = 0;
+    for (int i = 0; i < result_cnt; i++)
+    {
+        bench_result_t *result = &results[i];
+
+        // CPU 가 지원하지 않으면 force 가 스칼라로 떨어지므로 실제 선택된 커널로 확인
+        sensor_stats_force_kernel(result->kernel);
+        result->supported = sensor_stats_kernel() == result->kernel;
+        if (!result->supported)
+        {
+            printf("%-8s %14s %14s %10s\n", result->name, "-", "-", "n/a");
+            continue;
+        }
+
+        bench_run(result, values, n, rounds, &threshold);
+
+        bool same = bench_same(result, &results[0]);
+        if (!same)
+        {
+            mismatch++;
+        }
+        printf("%-8s %14.3f %14.3f %10s\n", result->name, result->accumulate_ms, result->scan_ms, same ? "ok" : "MISMATCH");
+    }
+
+    sensor_stats_t stats;
+    sensor_stats_finalize(&results[0].acc, &stats);
+    printf("[BENCH] min=%d max=%d mean=%.2f stddev=%.2f rms=%.2f warning=%llu error=%llu\n",
+           stats.min, stats.max, stats.mean, stats.stddev, stats.rms,
+           (unsigned long long)results[0].scan.warning_cnt,
+           (unsigned long long)results[0].scan.error_cnt);
+
+    free(values);
+    return mismatch ? 1 : 0;
+}
+
+// ------------- static method -------------
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 대부분 정상 범위(-5~55도)에 두고 64개 중 1개 꼴로 전 범위 값을 섞음 (경고/에러 구간이 모두 나오게)
+static void bench_fill(int16_t *values, size_t n)
+{
+    uint32_t state = 0x2545F491u;
+    for (size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if ((state & 63) == 0)
+        {
+            values[i] = (int16_t)(state >> 16);
+        }
+        else
+        {
+            values[i] = (int16_t)(-500 + (int32_t)((state >> 16) % 6000));
+        }
+    }
+}
+
+static void bench_run(bench_result_t *result, const int16_t *values, size_t n, int rounds, const sensor_threshold_raw_t *threshold)
+{
+    uint64_t best_acc = UINT64_MAX;
+    uint64_t best_scan = UINT64_MAX;
+
+    for (int r = 0; r < rounds; r++)
+    {
+        uint64_t t0 = bench_now_ns();
+        sensor_stats_acc_init(&result->acc);
+        sensor_stats_accumulate(&result->acc, values, n);
+        uint64_t t1 = bench_now_ns();
+        memset(&result->scan, 0, sizeof(result->scan));
+        sensor_stats_scan(&result->scan, values, n, threshold);
+        uint64_t t2 = bench_now_ns();
+
+        if (t1 - t0 < best_acc)
+        {
+            best_acc = t1 - t0;
+        }
+        if (t2 - t1 < best_scan)
+        {
+            best_scan = t2 - t1;
+        }
+    }
+
+    result->accumulate_ms = best_acc / 1e6;
+    result->scan_ms = best_scan / 1e6;
+}
+
+static bool bench_same(const bench_result_t *a, const bench_result_t *b)
+{
+    return a->acc.count == b->acc.count &&
+           a->acc.min == b->acc.min &&
+           a->acc.max == b->acc.max &&
+           a->acc.sum == b->acc.sum &&
+           a->acc.sum_sq == b->acc.sum_sq &&
+           a->scan.warning_cnt == b->scan.warning_cnt &&
+           a->scan.error_cnt == b->scan.error_cnt;
+}
@@ -0,0 +1,864 @@
+#include "include/sensor_store.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define SENSOR_STORE_DIR_MAX 256
+#define SENSOR_STORE_PATH_MAX (SENSOR_STORE_DIR_MAX + 32)
+
+#ifndef _WIN32
+// 봉인된 세그먼트 매핑 (조회할 때 필요한 페이지만 읽힘)
+typedef struct
+{
+    uint32_t seq;
+    void *map;
+    size_t map_size;
+    const sensor_store_record_t *records; // (sensor_id, timestamp_ns) 순서
+    const sensor_store_index_t *index;
+    const sensor_store_footer_t *footer;
+} sensor_store_segment_t;
+
+struct sensor_store
+{
+    char dir[SENSOR_STORE_DIR_MAX];
+    uint64_t window_ns;
+    uint32_t segment_records;
+
+    sensor_store_segment_t *segments; // 번호 순서 (= 시간 순서)
+    uint32_t segment_cnt;
+    uint32_t segment_cap;
+    uint32_t next_seq;
+
+    // 기록 중인 세그먼트 (파일에는 도착 순서로 덧붙이고, 같은 내용을 메모리에 유지)
+    FILE *file;
+    uint32_t active_seq;
+    uint64_t active_window_ns;
+    sensor_store_record_t *records;
+    uint32_t active_cnt;
+
+    // 봉인 중인 세그먼트 (봉인 스레드가 정렬, 기록, fsync 하는 동안 조회는 여기를 훑음, sealing_cnt 0 이면 빈 버퍼)
+    pthread_t sealer;
+    bool sealer_started;
+    bool stopping;
+    pthread_mutex_t lock; // segments 와 sealing_* 보호
+    pthread_cond_t cond;  // 봉인할 세그먼트가 넘어오거나 봉인이 끝남
+    sensor_store_record_t *sealing;
+    uint32_t sealing_cnt;
+    uint32_t sealing_seq;
+    uint64_t sealing_window_ns;
+
+    uint64_t recovered_records;
+};
+
+static bool sensor_store_recover(sensor_store_t *store);
+static void sensor_store_recover_segment(sensor_store_t *store, uint32_t seq, const char *path);
+static bool sensor_store_map_segment(sensor_store_t *store, uint32_t seq, const char *path);
+static bool sensor_store_write_segment(sensor_store_t *store, uint32_t seq, uint64_t window_start_ns,
+                                       const sensor_store_record_t *records, uint32_t cnt);
+static can_error_t sensor_store_start_active(sensor_store_t *store, uint64_t window_start_ns);
+static void sensor_store_seal_active(sensor_store_t *store);
+static void *sensor_store_sealer(void *arg);
+static int sensor_store_scan_arrival(const sensor_store_record_t *records, uint32_t cnt, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                                     sensor_sample_t *samples, int n, int max);
+static void sensor_store_sort_run(sensor_store_record_t *records, sensor_store_record_t *scratch, uint32_t cnt);
+static void sensor_store_segment_path(const sensor_store_t *store, uint32_t seq, char *path, size_t size);
+static int sensor_store_index_lower_bound(const sensor_store_segment_t *segment, uint8_t sensor_id, uint64_t timestamp_ns);
+static uint32_t sensor_store_hash(const void *data, size_t len);
+static uint16_t sensor_store_record_check(const sensor_store_record_t *record);
+static int sensor_store_compare_seq(const void *a, const void *b);
+
+// dir 의 세그먼트를 열고 봉인되지 않은 마지막 세그먼트를 복구 (dir 이 없으면 생성)
+sensor_store_t *sensor_store_open(const char *dir, const sensor_store_config_t *config)
+{
+    if (!dir || strlen(dir) >= SENSOR_STORE_DIR_MAX)
+    {
+        return NULL;
+    }
+
+    sensor_store_t *store = calloc(1, sizeof(sensor_store_t));
+    if (!store)
+    {
+        return NULL;
+    }
+
+    strcpy(store->dir, dir);
+    store->window_ns = config && config->window_ns ? config->window_ns : SENSOR_STORE_WINDOW_NS;
+    store->segment_records = config && config->segment_records ? config->segment_records : SENSOR_STORE_SEGMENT_RECORDS;
+    store->records = malloc(sizeof(sensor_store_record_t) * store->segment_records);
+    store->sealing = malloc(sizeof(sensor_store_record_t) * store->segment_records);
+    pthread_mutex_init(&store->lock, NULL);
+    pthread_cond_init(&store->cond, NULL);
+
+    if (!store->records || !store->sealing || (mkdir(dir, 0755) != 0 && errno != EEXIST) || !sensor_store_recover(store))
+    {
+        printf("[STORE] Failed to open '%s'\n", dir);
+        sensor_store_close(store);
+        return NULL;
+    }
+
+    store->sealer_started = pthread_create(&store->sealer, NULL, sensor_store_sealer, store) == 0;
+    if (!store->sealer_started)
+    {
+        printf("[STORE] Failed to open '%s'\n", dir);
+        sensor_store_close(store);
+        return NULL;
+    }
+
+    printf("[STORE] Opened '%s' (%u segments)\n", dir, store->segment_cnt);
+    return store;
+}
+
+// 기록 중인 세그먼트를 봉인하고 닫음
+void sensor_store_close(sensor_store_t *store)
+{
+    if (!store)
+    {
+        return;
+    }
+
+    // 넘겨준 세그먼트까지 봉인한 뒤 봉인 스레드 종료
+    sensor_store_seal_active(store);
+    if (store->sealer_started)
+    {
+        pthread_mutex_lock(&store->lock);
+        store->stopping = true;
+        pthread_cond_broadcast(&store->cond);
+        pthread_mutex_unlock(&store->lock);
+        pthread_join(store->sealer, NULL);
+    }
+
+    for (uint32_t i = 0; i < store->segment_cnt; i++)
+    {
+        munmap(store->segments[i].map, store->segments[i].map_size);
+    }
+    pthread_mutex_destroy(&store->lock);
+    pthread_cond_destroy(&store->cond);
+    free(store->segments);
+    free(store->records);
+    free(store->sealing);
+    free(store);
+}
+
+// 샘플 추가 (시간 창이 바뀌거나 세그먼트가 차면 봉인 스레드에 넘기고 새 세그먼트 시작)
+// 앞 세그먼트를 아직 봉인 중일 때만 그 봉인이 끝날 때까지 기다림
+can_error_t sensor_store_append(sensor_store_t *store, uint64_t timestamp_ns, const sensor_data_msg_t *msg)
+{
+    if (!store || !msg)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    uint64_t window_start_ns = timestamp_ns - timestamp_ns % store->window_ns;
+    if (store->file && (window_start_ns != store->active_window_ns || store->active_cnt >= store->segment_records))
+    {
+        sensor_store_seal_active(store);
+    }
+
+    if (!store->file)
+    {
+        can_error_t result = sensor_store_start_active(store, window_start_ns);
+        if (result != CAN_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    sensor_store_record_t *record = &store->records[store->active_cnt];
+    memset(record, 0, sizeof(sensor_store_record_t));
+    record->timestamp_ns = timestamp_ns;
+    record->value = msg->value;
+    record->sequence = msg->sequence;
+    record->sensor_id = msg->sensor_id;
+    record->status = msg->status;
+    record->check = sensor_store_record_check(record);
+
+    if (fwrite(record, sizeof(sensor_store_record_t), 1, store->file) != 1)
+    {
+        return CAN_ERROR_SEND_FAILED;
+    }
+
+    store->active_cnt++;
+    return CAN_SUCCESS;
+}
+
+// 쓰기 버퍼를 파일로 내보냄 (비정상 종료 시 여기까지 기록된 레코드는 복구됨)
+can_error_t sensor_store_flush(sensor_store_t *store)
+{
+    if (!store)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (store->file && fflush(store->file) != 0)
+    {
+        return CAN_ERROR_SEND_FAILED;
+    }
+    return CAN_SUCCESS;
+}
+
+// sensor_id 의 [t0_ns, t1_ns) 샘플을 시간순으로 최대 max 개 복사 (복사한 수 반환)
+int sensor_store_query(const sensor_store_t *store, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max)
+{
+    if (!store || !samples || max <= 0 || t0_ns >= t1_ns)
+    {
+        return 0;
+    }
+
+    // 봉인 스레드가 세그먼트를 추가하는 동안에는 기다림 (잠금만 쓰고 저장소 내용은 바꾸지 않음)
+    pthread_mutex_t *lock = (pthread_mutex_t *)&store->lock;
+    pthread_mutex_lock(lock);
+
+    int n = 0;
+    for (uint32_t s = 0; s < store->segment_cnt && n < max; s++)
+    {
+        const sensor_store_segment_t *segment = &store->segments[s];
+        if (segment->footer->max_ts_ns < t0_ns || segment->footer->min_ts_ns >= t1_ns)
+        {
+            continue;
+        }
+
+        // (sensor_id, t0) 바로 앞 색인 항목부터 읽기 시작
+        int lower = sensor_store_index_lower_bound(segment, sensor_id, t0_ns);
+        uint64_t i = lower > 0 ? segment->index[lower - 1].record_idx : 0;
+
+        for (; i < segment->footer->record_cnt && n < max; i++)
+        {
+            const sensor_store_record_t *record = &segment->records[i];
+            if (record->sensor_id != sensor_id || record->timestamp_ns < t0_ns)
+            {
+                if (record->sensor_id > sensor_id)
+                {
+                    break;
+                }
+                continue;
+            }
+            if (record->timestamp_ns >= t1_ns)
+            {
+                break;
+            }
+
+            samples[n].timestamp_ns = record->timestamp_ns;
+            samples[n].value = record->value;
+            samples[n].status = record->status;
+            samples[n].sequence = record->sequence;
+            n++;
+        }
+    }
+
+    // 봉인 중인 세그먼트와 기록 중인 세그먼트는 도착 순서이므로 전체를 훑음
+    n = sensor_store_scan_arrival(store->sealing, store->sealing_cnt, sensor_id, t0_ns, t1_ns, samples, n, max);
+    n = sensor_store_scan_arrival(store->records, store->active_cnt, sensor_id, t0_ns, t1_ns, samples, n, max);
+
+    pthread_mutex_unlock(lock);
+    return n;
+}
+
+void sensor_store_get_stats(const sensor_store_t *store, sensor_store_stats_t *stats)
+{
+    if (!store || !stats)
+    {
+        return;
+    }
+
+    pthread_mutex_t *lock = (pthread_mutex_t *)&store->lock;
+    pthread_mutex_lock(lock);
+
+    memset(stats, 0, sizeof(sensor_store_stats_t));
+    stats->segments = store->segment_cnt;
+    for (uint32_t i = 0; i < store->segment_cnt; i++)
+    {
+        stats->sealed_records += store->segments[i].footer->record_cnt;
+    }
+    stats->active_records = store->active_cnt + store->sealing_cnt;
+    stats->recovered_records = store->recovered_records;
+
+    pthread_mutex_unlock(lock);
+}
+
+// ------------- static method -------------
+// 세그먼트 번호 순서로 매핑하고, 봉인되지 않은 세그먼트는 복구 후 봉인 (남은 임시 파일은 삭제)
+static bool sensor_store_recover(sensor_store_t *store)
+{
+    DIR *dir = opendir(store->dir);
+    if (!dir)
+    {
+        return false;
+    }
+
+    uint32_t *seqs = NULL;
+    uint32_t seq_cnt = 0;
+    uint32_t seq_cap = 0;
+    char path[SENSOR_STORE_PATH_MAX];
+    struct dirent *entry;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        uint32_t seq;
+        char tail[8] = {0};
+        if (sscanf(entry->d_name, "%8u.seg%7s", &seq, tail) < 1 || strlen(entry->d_name) < 12 ||
+            strncmp(entry->d_name + 8, ".seg", 4) != 0)
+        {
+            continue;
+        }
+
+        if (strcmp(tail, ".tmp") == 0)
+        {
+            snprintf(path, sizeof(path), "%s/%s", store->dir, entry->d_name);
+            unlink(path);
+            continue;
+        }
+        if (tail[0] != '\0')
+        {
+            continue;
+        }
+
+        if (seq_cnt == seq_cap)
+        {
+            seq_cap = seq_cap ? seq_cap * 2 : 64;
+            uint32_t *grown = realloc(seqs, sizeof(uint32_t) * seq_cap);
+            if (!grown)
+            {
+                free(seqs);
+                closedir(dir);
+                return false;
+            }
+            seqs = grown;
+        }
+        seqs[seq_cnt++] = seq;
+    }
+    closedir(dir);
+
+    qsort(seqs, seq_cnt, sizeof(uint32_t), sensor_store_compare_seq);
+    for (uint32_t i = 0; i < seq_cnt; i++)
+    {
+        sensor_store_segment_path(store, seqs[i], path, sizeof(path));
+        if (!sensor_store_map_segment(store, seqs[i], path))
+        {
+            sensor_store_recover_segment(store, seqs[i], path);
+        }
+        store->next_seq = seqs[i] + 1;
+    }
+
+    free(seqs);
+    return true;
+}
+
+// 봉인되지 않은 세그먼트에서 check 가 맞는 레코드까지만 살려서 봉인 (살릴 게 없으면 삭제)
+static void sensor_store_recover_segment(sensor_store_t *store, uint32_t seq, const char *path)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return;
+    }
+
+    size_t map_size = (size_t)st.st_size;
+    void *map = map_size >= sizeof(sensor_store_header_t) ? mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+
+    const sensor_store_header_t *header = map != MAP_FAILED ? map : NULL;
+    if (!header || header->magic != SENSOR_STORE_MAGIC || header->version != SENSOR_STORE_VERSION ||
+        header->record_size != sizeof(sensor_store_record_t))
+    {
+        if (header)
+        {
+            munmap(map, map_size);
+        }
+        printf("[STORE] Discarding unreadable segment %08u\n", seq);
+        unlink(path);
+        return;
+    }
+
+    // 기록 중 끊긴 꼬리는 크기가 모자라거나 check 가 맞지 않음
+    const sensor_store_record_t *records = (const sensor_store_record_t *)(header + 1);
+    size_t record_cnt = (map_size - sizeof(sensor_store_header_t)) / sizeof(sensor_store_record_t);
+    uint32_t valid = 0;
+    while (valid < record_cnt && valid < UINT32_MAX && records[valid].check == sensor_store_record_check(&records[valid]))
+    {
+        valid++;
+    }
+
+    bool sealed = valid > 0 && sensor_store_write_segment(store, seq, header->window_start_ns, records, valid) &&
+                  sensor_store_map_segment(store, seq, path);
+    munmap(map, map_size);
+
+    if (sealed)
+    {
+        store->recovered_records += valid;
+        printf("[STORE] Recovered %u records from segment %08u\n", valid, seq);
+    }
+    else
+    {
+        unlink(path);
+    }
+}
+
+// 봉인된 세그먼트를 읽기 전용으로 매핑 (헤더/끝이 맞지 않으면 false, 봉인 스레드가 돌고 있으면 store->lock 안에서 호출)
+static bool sensor_store_map_segment(sensor_store_t *store, uint32_t seq, const char *path)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)(sizeof(sensor_store_header_t) + sizeof(sensor_store_footer_t)))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t map_size = (size_t)st.st_size;
+    void *map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const sensor_store_header_t *header = map;
+    const sensor_store_footer_t *footer = (const sensor_store_footer_t *)((const char *)map + map_size - sizeof(sensor_store_footer_t));
+    size_t expected_size = sizeof(sensor_store_header_t) + footer->record_cnt * sizeof(sensor_store_record_t) +
+                           (size_t)footer->index_cnt * sizeof(sensor_store_index_t) + sizeof(sensor_store_footer_t);
+
+    if (header->magic != SENSOR_STORE_MAGIC || header->version != SENSOR_STORE_VERSION ||
+        header->record_size != sizeof(sensor_store_record_t) || footer->magic != SENSOR_STORE_FOOTER_MAGIC ||
+        footer->check != sensor_store_hash(footer, offsetof(sensor_store_footer_t, magic)) || expected_size != map_size ||
+        footer->index_offset != map_size - sizeof(sensor_store_footer_t) - (size_t)footer->index_cnt * sizeof(sensor_store_index_t))
+    {
+        munmap(map, map_size);
+        return false;
+    }
+
+    if (store->segment_cnt == store->segment_cap)
+    {
+        uint32_t cap = store->segment_cap ? store->segment_cap * 2 : 16;
+        sensor_store_segment_t *grown = realloc(store->segments, sizeof(sensor_store_segment_t) * cap);
+        if (!grown)
+        {
+            munmap(map, map_size);
+            return false;
+        }
+        store->segments = grown;
+        store->segment_cap = cap;
+    }
+
+    // 조회는 색인으로 건너뛰며 읽으므로 미리 읽기를 끔
+    madvise(map, map_size, MADV_RANDOM);
+
+    sensor_store_segment_t *segment = &store->segments[store->segment_cnt++];
+    segment->seq = seq;
+    segment->map = map;
+    segment->map_size = map_size;
+    segment->records = (const sensor_store_record_t *)(header + 1);
+    segment->index = (const sensor_store_index_t *)((const char *)map + footer->index_offset);
+    segment->footer = footer;
+    return true;
+}
+
+// 레코드를 (sensor_id, 시각) 순서로 정렬하고 희소 색인과 끝을 붙여 임시 파일에 쓴 뒤 원래 이름으로 교체 (매핑은 호출자가 함)
+static bool sensor_store_write_segment(sensor_store_t *store, uint32_t seq, uint64_t window_start_ns,
+                                       const sensor_store_record_t *records, uint32_t cnt)
+{
+    // sensor_id 로 안정 계수 정렬한 뒤 센서별 구간을 시각으로 안정 정렬 (같은 시각은 도착 순서 유지)
+    uint32_t offset[257] = {0};
+    for (uint32_t i = 0; i < cnt; i++)
+    {
+        offset[records[i].sensor_id + 1]++;
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        offset[i + 1] += offset[i];
+    }
+
+    sensor_store_record_t *sorted = malloc(sizeof(sensor_store_record_t) * cnt);
+    sensor_store_index_t *index = calloc(cnt / SENSOR_STORE_INDEX_STRIDE + 257, sizeof(sensor_store_index_t));
+    if (!sorted || !index)
+    {
+        free(sorted);
+        free(index);
+        return false;
+    }
+
+    sensor_store_footer_t footer = {0};
+    footer.record_cnt = cnt;
+    footer.min_ts_ns = UINT64_MAX;
+    for (uint32_t i = 0; i < cnt; i++)
+    {
+        sorted[offset[records[i].sensor_id]++] = records[i];
+        footer.min_ts_ns = records[i].timestamp_ns < footer.min_ts_ns ? records[i].timestamp_ns : footer.min_ts_ns;
+        footer.max_ts_ns = records[i].timestamp_ns > footer.max_ts_ns ? records[i].timestamp_ns : footer.max_ts_ns;
+    }
+
+    // 벽시계(TIME_UTC)는 뒤로 갈 수 있으므로 도착 순서가 시간 순서라고 가정하지 않음 (이미 정렬된 구간은 건너뜀)
+    sensor_store_record_t *scratch = NULL;
+    for (uint32_t start = 0; start < cnt;)
+    {
+        uint32_t end = start + 1;
+        bool ordered = true;
+        while (end < cnt && sorted[end].sensor_id == sorted[start].sensor_id)
+        {
+            ordered = ordered && sorted[end - 1].timestamp_ns <= sorted[end].timestamp_ns;
+            end++;
+        }
+
+        if (!ordered)
+        {
+            if (!scratch && !(scratch = malloc(sizeof(sensor_store_record_t) * cnt)))
+            {
+                free(sorted);
+                free(index);
+                return false;
+            }
+            sensor_store_sort_run(&sorted[start], scratch, end - start);
+        }
+        start = end;
+    }
+    free(scratch);
+
+    // 센서마다 첫 레코드와 이후 SENSOR_STORE_INDEX_STRIDE 개마다 색인 항목
+    uint32_t run = 0;
+    for (uint32_t i = 0; i < cnt; i++)
+    {
+        run = i > 0 && sorted[i].sensor_id == sorted[i - 1].sensor_id ? run + 1 : 0;
+        if (run % SENSOR_STORE_INDEX_STRIDE == 0)
+        {
+            sensor_store_index_t *entry = &index[footer.index_cnt++];
+            entry->timestamp_ns = sorted[i].timestamp_ns;
+            entry->record_idx = i;
+            entry->sensor_id = sorted[i].sensor_id;
+        }
+    }
+
+    sensor_store_header_t header = {0};
+    header.magic = SENSOR_STORE_MAGIC;
+    header.version = SENSOR_STORE_VERSION;
+    header.record_size = sizeof(sensor_store_record_t);
+    header.window_start_ns = window_start_ns;
+    header.window_ns = store->window_ns;
+    header.seq = seq;
+
+    footer.index_offset = sizeof(sensor_store_header_t) + (uint64_t)cnt * sizeof(sensor_store_record_t);
+    footer.magic = SENSOR_STORE_FOOTER_MAGIC;
+    footer.check = sensor_store_hash(&footer, offsetof(sensor_store_footer_t, magic));
+
+    char path[SENSOR_STORE_PATH_MAX];
+    char tmp_path[SENSOR_STORE_PATH_MAX + 8];
+    sensor_store_segment_path(store, seq, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    FILE *file = fopen(tmp_path, "wb");
+    bool ok = file && fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(sorted, sizeof(sensor_store_record_t), cnt, file) == cnt &&
+              fwrite(index, sizeof(sensor_store_index_t), footer.index_cnt, file) == footer.index_cnt &&
+              fwrite(&footer, sizeof(footer), 1, file) == 1 && fflush(file) == 0 && fsync(fileno(file)) == 0;
+    if (file)
+    {
+        ok = fclose(file) == 0 && ok;
+    }
+    free(sorted);
+    free(index);
+
+    // 교체는 원자적이므로 중간에 멈춰도 봉인 전 또는 봉인 후 파일 하나만 남음
+    if (!ok || rename(tmp_path, path) != 0)
+    {
+        printf("[STORE] Failed to seal segment %08u\n", seq);
+        unlink(tmp_path);
+        return false;
+    }
+
+    int dir_fd = open(store->dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0)
+    {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+
+    return true;
+}
+
+static can_error_t sensor_store_start_active(sensor_store_t *store, uint64_t window_start_ns)
+{
+    char path[SENSOR_STORE_PATH_MAX];
+    sensor_store_segment_path(store, store->next_seq, path, sizeof(path));
+
+    store->file = fopen(path, "wb");
+    if (!store->file)
+    {
+        printf("[STORE] Failed to create '%s'\n", path);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    sensor_store_header_t header = {0};
+    header.magic = SENSOR_STORE_MAGIC;
+    header.version = SENSOR_STORE_VERSION;
+    header.record_size = sizeof(sensor_store_record_t);
+    header.window_start_ns = window_start_ns;
+    header.window_ns = store->window_ns;
+    header.seq = store->next_seq;
+    if (fwrite(&header, sizeof(header), 1, store->file) != 1)
+    {
+        fclose(store->file);
+        store->file = NULL;
+        unlink(path);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    store->active_seq = store->next_seq++;
+    store->active_window_ns = window_start_ns;
+    store->active_cnt = 0;
+    return CAN_SUCCESS;
+}
+
+// 기록 중인 세그먼트를 봉인 스레드에 넘기고 빈 버퍼로 바꿈 (봉인에 실패하면 파일이 그대로 남아 다음 시작 때 복구)
+static void sensor_store_seal_active(sensor_store_t *store)
+{
+    if (!store->file)
+    {
+        return;
+    }
+
+    fclose(store->file);
+    store->file = NULL;
+
+    if (store->active_cnt == 0)
+    {
+        char path[SENSOR_STORE_PATH_MAX];
+        sensor_store_segment_path(store, store->active_seq, path, sizeof(path));
+        unlink(path);
+        return;
+    }
+
+    pthread_mutex_lock(&store->lock);
+    while (store->sealing_cnt > 0)
+    {
+        pthread_cond_wait(&store->cond, &store->lock);
+    }
+
+    sensor_store_record_t *spare = store->sealing;
+    store->sealing = store->records;
+    store->sealing_cnt = store->active_cnt;
+    store->sealing_seq = store->active_seq;
+    store->sealing_window_ns = store->active_window_ns;
+    store->records = spare;
+    store->active_cnt = 0;
+
+    pthread_cond_broadcast(&store->cond);
+    pthread_mutex_unlock(&store->lock);
+}
+
+// 넘겨받은 세그먼트를 정렬, 기록, fsync 하고 매핑 (매핑과 버퍼 반환을 한 번에 하여 조회에 중복/누락이 없음)
+static void *sensor_store_sealer(void *arg)
+{
+    sensor_store_t *store = arg;
+
+    pthread_mutex_lock(&store->lock);
+    while (true)
+    {
+        while (store->sealing_cnt == 0 && !store->stopping)
+        {
+            pthread_cond_wait(&store->cond, &store->lock);
+        }
+        if (store->sealing_cnt == 0)
+        {
+            break;
+        }
+
+        // 봉인하는 동안 버퍼는 바뀌지 않음 (다음 봉인은 sealing_cnt 가 0 이 될 때까지 기다림)
+        uint32_t seq = store->sealing_seq;
+        pthread_mutex_unlock(&store->lock);
+        bool sealed = sensor_store_write_segment(store, seq, store->sealing_window_ns, store->sealing, store->sealing_cnt);
+        pthread_mutex_lock(&store->lock);
+
+        char path[SENSOR_STORE_PATH_MAX];
+        sensor_store_segment_path(store, seq, path, sizeof(path));
+        if (sealed && !sensor_store_map_segment(store, seq, path))
+        {
+            printf("[STORE] Failed to map segment %08u\n", seq);
+        }
+        store->sealing_cnt = 0;
+        pthread_cond_broadcast(&store->cond);
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    return NULL;
+}
+
+// 도착 순서인 레코드에서 sensor_id 의 [t0_ns, t1_ns) 샘플을 samples[n] 부터 복사 (복사 후 개수 반환)
+static int sensor_store_scan_arrival(const sensor_store_record_t *records, uint32_t cnt, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns,
+                                     sensor_sample_t *samples, int n, int max)
+{
+    for (uint32_t i = 0; i < cnt && n < max; i++)
+    {
+        const sensor_store_record_t *record = &records[i];
+        if (record->sensor_id == sensor_id && record->timestamp_ns >= t0_ns && record->timestamp_ns < t1_ns)
+        {
+            samples[n].timestamp_ns = record->timestamp_ns;
+            samples[n].value = record->value;
+            samples[n].status = record->status;
+            samples[n].sequence = record->sequence;
+            n++;
+        }
+    }
+    return n;
+}
+
+// 한 센서의 구간을 시각으로 안정 병합 정렬 (아래에서 위로, scratch 는 cnt 개 이상)
+static void sensor_store_sort_run(sensor_store_record_t *records, sensor_store_record_t *scratch, uint32_t cnt)
+{
+    sensor_store_record_t *src = records;
+    sensor_store_record_t *dst = scratch;
+
+    for (size_t width = 1; width < cnt; width *= 2)
+    {
+        for (size_t lo = 0; lo < cnt; lo += 2 * width)
+        {
+            size_t mid = lo + width < cnt ? lo + width : cnt;
+            size_t hi = mid + width < cnt ? mid + width : cnt;
+            size_t i = lo;
+            size_t j = mid;
+            size_t k = lo;
+
+            // 같은 시각이면 앞 구간을 먼저 (안정)
+            while (i < mid && j < hi)
+            {
+                dst[k++] = src[j].timestamp_ns < src[i].timestamp_ns ? src[j++] : src[i++];
+            }
+            while (i < mid)
+            {
+                dst[k++] = src[i++];
+            }
+            while (j < hi)
+            {
+                dst[k++] = src[j++];
+            }
+        }
+
+        sensor_store_record_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != records)
+    {
+        memcpy(records, src, sizeof(sensor_store_record_t) * cnt);
+    }
+}
+
+static void sensor_store_segment_path(const sensor_store_t *store, uint32_t seq, char *path, size_t size)
+{
+    snprintf(path, size, "%s/%08u.seg", store->dir, seq);
+}
+
+// (sensor_id, timestamp_ns) 이상인 첫 색인 항목
+static int sensor_store_index_lower_bound(const sensor_store_segment_t *segment, uint8_t sensor_id, uint64_t timestamp_ns)
+{
+    uint32_t lo = 0;
+    uint32_t hi = segment->footer->index_cnt;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const sensor_store_index_t *entry = &segment->index[mid];
+        if (entry->sensor_id < sensor_id || (entry->sensor_id == sensor_id && entry->timestamp_ns < timestamp_ns))
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return (int)lo;
+}
+
+// FNV-1a
+static uint32_t sensor_store_hash(const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// 0 으로 채워진 레코드는 맞지 않도록 해시를 접어서 사용
+static uint16_t sensor_store_record_check(const sensor_store_record_t *record)
+{
+    uint32_t hash = sensor_store_hash(record, offsetof(sensor_store_record_t, check));
+    return (uint16_t)(hash ^ (hash >> 16));
+}
+
+static int sensor_store_compare_seq(const void *a, const void *b)
+{
+    uint32_t lhs = *(const uint32_t *)a;
+    uint32_t rhs = *(const uint32_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+#else
+// mmap 과 디렉터리 조회가 필요하므로 Windows 에서는 사용하지 않음
+sensor_store_t *sensor_store_open(const char *dir, const sensor_store_config_t *config)
+{
+    (void)config;
+    printf("[STORE] Segment store is not supported on this platform ('%s')\n", dir ? dir : "");
+    return NULL;
+}
+
+void sensor_store_close(sensor_store_t *store)
+{
+    (void)store;
+}
+
+can_error_t sensor_store_append(sensor_store_t *store, uint64_t timestamp_ns, const sensor_data_msg_t *msg)
+{
+    (void)store;
+    (void)timestamp_ns;
+    (void)msg;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+can_error_t sensor_store_flush(sensor_store_t *store)
+{
+    (void)store;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+int sensor_store_query(const sensor_store_t *store, uint8_t sensor_id, uint64_t t0_ns, uint64_t t1_ns, sensor_sample_t *samples, int max)
+{
+    (void)store;
+    (void)sensor_id;
+    (void)t0_ns;
+    (void)t1_ns;
+    (void)samples;
+    (void)max;
+    return 0;
+}
+
+void sensor_store_get_stats(const sensor_store_t *store, sensor_store_stats_t *stats)
+{
+    (void)store;
+    if (stats)
+    {
+        memset(stats, 0, sizeof(sensor_store_stats_t));
+    }
+}
+#endif
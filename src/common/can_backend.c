@@ -0,0 +1,156 @@
+#include "include/can_backend.h"
+#include "include/can_bus.h"
+#include "include/can_ring.h"
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+static can_error_t can_memory_open(can_endpoint_t *endpoint);
+static void can_memory_close(can_endpoint_t *endpoint);
+static int can_memory_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+static int can_memory_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms);
+static int can_memory_event_fd(can_endpoint_t *endpoint);
+static void can_memory_clear_event(can_endpoint_t *endpoint);
+
+// 프로세스 내부 버스 (같은 버스의 인터페이스 수신 큐에 배달)
+const can_backend_t g_can_memory_backend = {
+    .name = "memory",
+    .open = can_memory_open,
+    .close = can_memory_close,
+    .send = can_memory_send,
+    .receive = can_memory_receive,
+    .event_fd = can_memory_event_fd};
+
+const can_backend_t *can_backend_get(can_backend_type_t type)
+{
+    switch (type)
+    {
+    case CAN_BACKEND_MEMORY:
+        return &g_can_memory_backend;
+    case CAN_BACKEND_SOCKETCAN:
+        return &g_can_socketcan_backend;
+    case CAN_BACKEND_SHM:
+        return &g_can_shm_backend;
+    default:
+        return NULL;
+    }
+}
+
+// ------------- static method -------------
+static can_error_t can_memory_open(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+    return CAN_SUCCESS;
+}
+
+static void can_memory_close(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+}
+
+static int can_memory_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    return can_bus_transmit(endpoint, frames, n, timestamp_ns);
+}
+
+static int can_memory_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms)
+{
+    // 타임아웃 처리를 위한 마감 시각 (CLOCK_MONOTONIC)
+    uint64_t deadline_ns = CAN_DEADLINE_NONE;
+    if (timeout_ms > 0)
+    {
+        deadline_ns = can_monotonic_ns() + (uint64_t)timeout_ms * 1000000ull;
+    }
+
+    while (1)
+    {
+        // 필터는 송신 시점에 적용되었으므로 큐 앞에서 바로 꺼냄
+        uint32_t received = can_ring_pop_batch(endpoint->rx_queue, frames, (uint32_t)max);
+        if (received > 0)
+        {
+            return (int)received;
+        }
+
+        // 큐가 비었으므로 eventfd 신호 해제
+        can_memory_clear_event(endpoint);
+
+        if (timeout_ms == 0)
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        // 메시지가 발행되거나 마감 시각이 될 때까지 대기 (timeout_ms < 0 이면 무기한)
+        if (!can_ring_wait(endpoint->rx_queue, deadline_ns))
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        if (!atomic_load(&endpoint->is_connected))
+        {
+            return CAN_ERROR_NOT_CONNECTED;
+        }
+    }
+}
+
+// 큐에 메시지가 있으면 readable 한 eventfd (처음 호출 시 생성)
+static int can_memory_event_fd(can_endpoint_t *endpoint)
+{
+#ifdef __linux__
+    int fd = atomic_load_explicit(&endpoint->event_fd, memory_order_acquire);
+    if (fd >= 0)
+    {
+        return fd;
+    }
+
+    int new_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (new_fd < 0)
+    {
+        return -1;
+    }
+
+    if (!atomic_compare_exchange_strong(&endpoint->event_fd, &fd, new_fd))
+    {
+        // 다른 스레드가 먼저 생성함
+        close(new_fd);
+        return fd;
+    }
+
+    // 이미 쌓여있는 메시지가 있으면 바로 readable 상태로
+    if (can_ring_size(endpoint->rx_queue) > 0)
+    {
+        can_endpoint_signal(endpoint);
+    }
+    return new_fd;
+#else
+    (void)endpoint;
+    return -1;
+#endif
+}
+
+// 큐가 비었을 때 eventfd 신호 해제
+static void can_memory_clear_event(can_endpoint_t *endpoint)
+{
+#ifdef __linux__
+    int fd = atomic_load_explicit(&endpoint->event_fd, memory_order_acquire);
+    if (fd < 0 || !atomic_load(&endpoint->event_pending))
+    {
+        return;
+    }
+
+    // 카운터를 먼저 비운 뒤 pending 을 내려야 신호가 사라지지 않음
+    uint64_t value;
+    ssize_t nread = read(fd, &value, sizeof(value));
+    (void)nread;
+    atomic_store(&endpoint->event_pending, false);
+
+    // 해제 직후 들어온 메시지에 대한 신호 누락 방지
+    if (can_ring_size(endpoint->rx_queue) > 0)
+    {
+        can_endpoint_signal(endpoint);
+    }
+#else
+    (void)endpoint;
+#endif
+}
@@ -0,0 +1,476 @@
+#ifdef __linux__
+#define _GNU_SOURCE // pthread_setaffinity_np
+#endif
+
+#include "include/can_bus.h"
+#include "include/can_ring.h"
+#include "include/can_backend.h"
+#include "include/can_epoch.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+static can_bus_t g_buses[CAN_MAX_BUSES];
+static pthread_mutex_t g_bus_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int can_bus_open(const can_bus_config_t *config);
+static void *can_bus_worker(void *arg);
+static void can_bus_pin(can_bus_t *bus);
+static bool can_bus_pending(const can_subscribers_t *subscribers);
+static void can_bus_ring_doorbell(can_bus_t *bus);
+static int can_bus_fanout(can_bus_t *bus, const can_endpoint_t *source, const can_frame_t *frames, int n);
+static bool can_bus_is_target(const can_endpoint_t *target, const can_endpoint_t *source);
+static int can_deliver(can_endpoint_t *target, const can_frame_t *frames, int n);
+
+// 모든 버스를 정리하고 기본 버스 생성 (워커 없음)
+bool can_bus_init(void)
+{
+    can_bus_cleanup();
+
+    can_bus_config_t config = {0};
+    config.name = "bus0";
+
+    return can_bus_open(&config) == CAN_DEFAULT_BUS;
+}
+
+// 워커 스레드 종료 (엔드포인트는 레지스트리가 정리)
+void can_bus_cleanup(void)
+{
+    pthread_mutex_lock(&g_bus_lock);
+
+    for (uint32_t b = 0; b < CAN_MAX_BUSES; b++)
+    {
+        can_bus_t *bus = &g_buses[b];
+        if (!atomic_load(&bus->in_use))
+        {
+            continue;
+        }
+
+        if (bus->has_worker && atomic_exchange(&bus->running, false))
+        {
+            atomic_fetch_add(&bus->doorbell, 1);
+            can_futex_wake_all(&bus->doorbell, false);
+            pthread_join(bus->worker, NULL);
+        }
+
+        pthread_mutex_destroy(&bus->handler_lock);
+        atomic_store(&bus->in_use, false);
+    }
+
+    pthread_mutex_unlock(&g_bus_lock);
+}
+
+// 새 버스 생성 (버스 번호 또는 음수 에러 코드 반환)
+int can_create_bus(const can_bus_config_t *config)
+{
+    if (!config || !config->name)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    int bus_id = can_bus_open(config);
+    if (bus_id >= 0)
+    {
+        printf("[CAN] Bus '%s' is created (ID: %d, worker: %s)\n", config->name, bus_id, config->use_worker ? "yes" : "no");
+    }
+
+    return bus_id;
+}
+
+can_error_t can_get_bus_stats(uint32_t bus_id, can_bus_stats_t *stats)
+{
+    can_bus_t *bus = can_bus_get(bus_id);
+    if (!bus || !stats)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memset(stats, 0, sizeof(can_bus_stats_t));
+    stats->frames = can_metrics_read(&bus->metrics, CAN_METRIC_TX_FRAMES);
+    stats->undelivered = can_metrics_read(&bus->metrics, CAN_METRIC_TX_ERRORS);
+    stats->batches = atomic_load_explicit(&bus->batches, memory_order_relaxed);
+    stats->wakeups = atomic_load_explicit(&bus->wakeups, memory_order_relaxed);
+
+    can_epoch_enter();
+    const can_subscribers_t *subscribers = can_registry_bus_subscribers(bus_id);
+    stats->interface_cnt = subscribers ? subscribers->cnt : 0;
+    can_epoch_exit();
+
+    return CAN_SUCCESS;
+}
+
+can_bus_t *can_bus_get(uint32_t bus_id)
+{
+    if (bus_id >= CAN_MAX_BUSES || !atomic_load_explicit(&g_buses[bus_id].in_use, memory_order_acquire))
+    {
+        return NULL;
+    }
+
+    return &g_buses[bus_id];
+}
+
+// source 가 속한 버스에 메시지를 올림 (앞에서부터 연속으로 버스에 올라간 메시지 수 반환)
+// 워커가 있는 버스는 송신 큐에 적재만 하므로 반환값은 적재된 메시지 수
+// 워커 없는 버스는 배달하지 못한 메시지에서 멈추며 그 뒤의 메시지는 어디에도 배달되지 않음
+int can_bus_transmit(can_endpoint_t *source, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    can_bus_t *bus = can_bus_get(source->bus_id);
+    if (!bus)
+    {
+        return 0;
+    }
+
+    // 배치 전체에 같은 송신 시각을 기록 (큐에는 시각이 찍힌 복사본을 적재)
+    can_frame_t chunk[64];
+    int sent = 0;
+
+    for (int base = 0; base < n; base += 64)
+    {
+        int chunk_len = (n - base) < 64 ? (n - base) : 64;
+        memcpy(chunk, &frames[base], sizeof(can_frame_t) * (size_t)chunk_len);
+        for (int k = 0; k < chunk_len; k++)
+        {
+            chunk[k].timestamp_ns = timestamp_ns;
+        }
+
+        if (!bus->has_worker)
+        {
+            int prefix = can_bus_fanout(bus, source, chunk, chunk_len);
+            sent += prefix;
+            if (prefix < chunk_len)
+            {
+                break;
+            }
+            continue;
+        }
+
+        uint32_t pushed = can_ring_push_batch(source->tx_queue, chunk, (uint32_t)chunk_len);
+        while (pushed > 0 && pushed < (uint32_t)chunk_len)
+        {
+            uint32_t k = can_ring_push_batch(source->tx_queue, &chunk[pushed], (uint32_t)chunk_len - pushed);
+            if (k == 0)
+            {
+                break;
+            }
+            pushed += k;
+        }
+
+        sent += (int)pushed;
+        if (pushed < (uint32_t)chunk_len)
+        {
+            break; // 송신 큐가 가득 참
+        }
+    }
+
+    if (bus->has_worker && sent > 0)
+    {
+        can_bus_ring_doorbell(bus);
+    }
+
+    return sent;
+}
+
+// 수신 큐에 메시지가 적재되었음을 eventfd 로 알림 (신호가 없을 때만 write)
+void can_endpoint_signal(can_endpoint_t *endpoint)
+{
+#ifdef __linux__
+    int fd = atomic_load_explicit(&endpoint->event_fd, memory_order_acquire);
+    if (fd < 0 || atomic_exchange(&endpoint->event_pending, true))
+    {
+        return;
+    }
+
+    uint64_t one = 1;
+    ssize_t written = write(fd, &one, sizeof(one));
+    (void)written;
+#else
+    (void)endpoint;
+#endif
+}
+
+// ------------- static method -------------
+static int can_bus_open(const can_bus_config_t *config)
+{
+    pthread_mutex_lock(&g_bus_lock);
+
+    can_bus_t *bus = NULL;
+    uint32_t bus_id = 0;
+    for (; bus_id < CAN_MAX_BUSES; bus_id++)
+    {
+        if (!atomic_load(&g_buses[bus_id].in_use))
+        {
+            bus = &g_buses[bus_id];
+            break;
+        }
+    }
+
+    if (!bus)
+    {
+        pthread_mutex_unlock(&g_bus_lock);
+        printf("[CAN] Maximum number of buses reached\n");
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    memset(bus, 0, sizeof(can_bus_t));
+    snprintf(bus->name, sizeof(bus->name), "%s", config->name);
+    bus->id = bus_id;
+    bus->has_worker = config->use_worker;
+    bus->cpu = config->pin_cpu ? config->cpu : -1;
+    bus->handler = config->handler;
+    bus->handler_ctx = config->handler_ctx;
+    pthread_mutex_init(&bus->handler_lock, NULL);
+    can_metrics_reset(&bus->metrics);
+
+    if (bus->has_worker)
+    {
+        atomic_store(&bus->running, true);
+        if (pthread_create(&bus->worker, NULL, can_bus_worker, bus) != 0)
+        {
+            atomic_store(&bus->running, false);
+            pthread_mutex_unlock(&g_bus_lock);
+            printf("[CAN] Failed to start worker for bus '%s'\n", bus->name);
+            return CAN_ERROR_INIT_FAILED;
+        }
+    }
+
+    atomic_store_explicit(&bus->in_use, true, memory_order_release);
+    pthread_mutex_unlock(&g_bus_lock);
+    return (int)bus_id;
+}
+
+// 버스 전용 워커: 버스에 속한 인터페이스의 송신 큐를 돌아가며 비우고 같은 버스에만 배달
+static void *can_bus_worker(void *arg)
+{
+    can_bus_t *bus = arg;
+    can_frame_t frames[CAN_BUS_DRAIN_BATCH];
+
+    can_bus_pin(bus);
+
+    while (atomic_load(&bus->running))
+    {
+        uint32_t doorbell = atomic_load(&bus->doorbell);
+        bool drained = false;
+
+        // 목록과 필터 뱅크는 한 바퀴 동안만 사용 (대기 중에는 can_epoch 구간 밖)
+        can_epoch_enter();
+        const can_subscribers_t *subscribers = can_registry_bus_subscribers(bus->id);
+
+        for (int i = 0; subscribers && i < subscribers->cnt; i++)
+        {
+            can_endpoint_t *source = subscribers->endpoints[i];
+            if (!source->tx_queue || source->backend != &g_can_memory_backend)
+            {
+                continue;
+            }
+
+            uint32_t n = can_ring_pop_batch(source->tx_queue, frames, CAN_BUS_DRAIN_BATCH);
+            if (n > 0)
+            {
+                // 되돌려 줄 송신자가 없으므로 배달하지 못한 메시지는 버리고 다음 메시지부터 계속
+                int done = 0;
+                while (done < (int)n)
+                {
+                    done += can_bus_fanout(bus, source, &frames[done], (int)n - done) + 1;
+                }
+                atomic_store_explicit(&bus->batches, atomic_load_explicit(&bus->batches, memory_order_relaxed) + 1, memory_order_relaxed);
+                drained = true;
+            }
+        }
+
+        if (drained)
+        {
+            can_epoch_exit();
+            continue;
+        }
+
+        // 대기 표시 후 다시 확인 (표시 전에 적재한 송신자는 도어벨을 울리지 않음)
+        atomic_store(&bus->worker_waiting, true);
+        bool pending = can_bus_pending(subscribers);
+        can_epoch_exit();
+        if (!pending)
+        {
+            can_futex_wait(&bus->doorbell, doorbell, CAN_DEADLINE_NONE, false);
+            atomic_store_explicit(&bus->wakeups, atomic_load_explicit(&bus->wakeups, memory_order_relaxed) + 1, memory_order_relaxed);
+        }
+        atomic_store(&bus->worker_waiting, false);
+    }
+
+    return NULL;
+}
+
+// 워커 스레드를 설정된 CPU 에 고정
+static void can_bus_pin(can_bus_t *bus)
+{
+    if (bus->cpu < 0)
+    {
+        return;
+    }
+
+#ifdef __linux__
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(bus->cpu, &cpus);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0)
+    {
+        printf("[CAN] Failed to pin worker of bus '%s' to CPU %d\n", bus->name, bus->cpu);
+    }
+#endif
+}
+
+static bool can_bus_pending(const can_subscribers_t *subscribers)
+{
+    for (int i = 0; subscribers && i < subscribers->cnt; i++)
+    {
+        if (subscribers->endpoints[i]->tx_queue && can_ring_size(subscribers->endpoints[i]->tx_queue) > 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// 워커가 대기 중일 때만 깨움 (적재 후 대기 표시를 읽어야 신호가 누락되지 않음)
+static void can_bus_ring_doorbell(can_bus_t *bus)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&bus->worker_waiting))
+    {
+        atomic_fetch_add(&bus->doorbell, 1);
+        can_futex_wake_all(&bus->doorbell, false);
+    }
+}
+
+// 필터를 통과한 같은 버스의 연결된 인터페이스 수신 큐에 순서대로 배달 (송신자 자신은 제외, n <= 64, can_epoch 구간 안에서 호출)
+// 받는 인터페이스 집합이 같은 연속 구간마다 모든 인터페이스에 같은 메시지를 적재하므로 각 수신 큐에는 구간의 앞부분이 들어감
+// 가장 많이 들어간 곳까지가 버스에 올라간 것이고 구간을 다 싣지 못했으면 거기서 멈춤 (앞에서부터 버스에 올라간 메시지 수 반환)
+// 멈춘 메시지 뒤로는 배달, 통계, 콜백 어디에도 반영되지 않으므로 호출자가 그대로 다시 보낼 수 있음
+static int can_bus_fanout(can_bus_t *bus, const can_endpoint_t *source, const can_frame_t *frames, int n)
+{
+    const can_subscribers_t *subscribers = can_registry_bus_subscribers(bus->id);
+    uint64_t all = n == 64 ? ~0ull : ((1ull << n) - 1);
+
+    // 어느 인터페이스든 수신 여부가 바뀌는 위치가 구간 경계
+    uint64_t starts = 1;
+    for (int i = 0; subscribers && i < subscribers->cnt; i++)
+    {
+        can_endpoint_t *target = subscribers->endpoints[i];
+        const can_filter_bank_t *filter = atomic_load_explicit(&target->filter, memory_order_acquire);
+        if (!filter || !can_bus_is_target(target, source))
+        {
+            continue;
+        }
+
+        uint64_t accept = 0;
+        for (int k = 0; k < n; k++)
+        {
+            if (can_filter_bank_accept(filter, frames[k].id, frames[k].is_extended))
+            {
+                accept |= 1ull << k;
+            }
+        }
+        starts |= (accept ^ (accept << 1)) & all;
+    }
+
+    int sent = 0;
+    bool stopped = false;
+
+    while (sent < n)
+    {
+        uint64_t rest = (starts & all) >> sent >> 1;
+        int len = rest ? __builtin_ctzll(rest) + 1 : n - sent;
+        bool matched = false;
+        int best = 0;
+
+        // 구간 안에서는 수신 여부가 같으므로 첫 메시지로 판정 (그 사이 필터가 바뀌었으면 새 필터 기준)
+        for (int i = 0; subscribers && i < subscribers->cnt; i++)
+        {
+            can_endpoint_t *target = subscribers->endpoints[i];
+            if (!can_bus_is_target(target, source))
+            {
+                continue;
+            }
+
+            const can_filter_bank_t *filter = atomic_load_explicit(&target->filter, memory_order_acquire);
+            if (filter && !can_filter_bank_accept(filter, frames[sent].id, frames[sent].is_extended))
+            {
+                can_metrics_add(&target->metrics, CAN_METRIC_FILTER_REJECTS, (uint64_t)len);
+                continue;
+            }
+
+            matched = true;
+            int pushed = can_deliver(target, &frames[sent], len);
+            if (pushed > best)
+            {
+                best = pushed;
+            }
+        }
+
+        if (matched && best < len)
+        {
+            sent += best;
+            stopped = true;
+            break;
+        }
+        sent += len;
+    }
+
+    for (int k = 0; k < sent; k++)
+    {
+        can_metrics_count_id(frames[k].id, frames[k].is_extended);
+    }
+
+    // 멈춘 메시지는 버스에 올라갔지만 배달되지 못한 것으로 계산
+    can_metrics_add(&bus->metrics, CAN_METRIC_TX_FRAMES, (uint64_t)sent + stopped);
+    can_metrics_add(&bus->metrics, CAN_METRIC_TX_ERRORS, (uint64_t)stopped);
+
+    // 워커 버스는 워커 하나만 호출하므로 잠그지 않음
+    if (bus->handler && sent > 0)
+    {
+        if (!bus->has_worker)
+        {
+            pthread_mutex_lock(&bus->handler_lock);
+        }
+        bus->handler(bus->handler_ctx, frames, sent);
+        if (!bus->has_worker)
+        {
+            pthread_mutex_unlock(&bus->handler_lock);
+        }
+    }
+
+    return sent;
+}
+
+// 같은 버스의 메시지를 받을 인터페이스인지 (송신자 자신과 연결되지 않은 인터페이스 제외)
+static bool can_bus_is_target(const can_endpoint_t *target, const can_endpoint_t *source)
+{
+    return target != source && target->backend == &g_can_memory_backend &&
+           atomic_load_explicit(&target->is_connected, memory_order_relaxed);
+}
+
+// 구간을 앞에서부터 자리가 있는 만큼 적재 (적재된 메시지 수 반환, 나머지는 수신측 오버런)
+static int can_deliver(can_endpoint_t *target, const can_frame_t *frames, int n)
+{
+    uint32_t pushed = 0;
+    while (pushed < (uint32_t)n)
+    {
+        uint32_t k = can_ring_push_batch(target->rx_queue, &frames[pushed], (uint32_t)n - pushed);
+        if (k == 0)
+        {
+            break;
+        }
+        pushed += k;
+    }
+
+    can_metrics_add(&target->metrics, CAN_METRIC_QUEUE_FULL_DROPS, (uint64_t)((uint32_t)n - pushed));
+    if (pushed > 0)
+    {
+        can_metrics_update_high_water(&target->metrics, can_ring_size(target->rx_queue));
+        can_endpoint_signal(target);
+    }
+    return (int)pushed;
+}
@@ -0,0 +1,410 @@
+#include "include/can_capture.h"
+#include "include/can_platform.h"
+#include "include/can_clock.h"
+#include <pthread.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// 다중 생산자/단일 소비자 링: 송신 스레드는 자리를 예약해 복사만 하고, 기록 스레드가 모아서 파일에 씀
+typedef struct
+{
+    _Atomic uint64_t seq; // pos + 1: pos 번째 레코드가 채워짐
+    can_capture_record_t record;
+} can_capture_slot_t;
+
+struct can_capture
+{
+    FILE *file;
+    pthread_t thread;
+    atomic_bool running;
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t head; // 송신 스레드가 다음에 예약할 위치
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t tail; // 기록 스레드가 다음에 읽을 위치
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t dropped; // 링이 가득 차서 버린 레코드 수
+
+    can_capture_slot_t *slots;
+    can_capture_record_t *buffer; // 기록 스레드 전용
+};
+
+static void *can_capture_writer(void *arg);
+static uint32_t can_capture_collect(can_capture_t *capture, uint32_t fill);
+static void can_capture_fill_record(can_capture_record_t *record, uint64_t timestamp_ns, uint16_t iface_idx, const can_frame_t *frame);
+static uint64_t can_replay_due(uint64_t start_ns, uint64_t first_ts, uint64_t timestamp_ns, double speed);
+
+can_capture_t *can_capture_open(const char *path)
+{
+    if (!path)
+    {
+        return NULL;
+    }
+
+    can_capture_t *capture = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(can_capture_t));
+    if (!capture)
+    {
+        return NULL;
+    }
+    memset(capture, 0, sizeof(can_capture_t));
+
+    capture->slots = calloc(CAN_CAPTURE_RING_RECORDS, sizeof(can_capture_slot_t));
+    capture->buffer = malloc(sizeof(can_capture_record_t) * CAN_CAPTURE_BUFFER_RECORDS);
+    capture->file = fopen(path, "wb");
+    if (!capture->slots || !capture->buffer || !capture->file)
+    {
+        printf("[CAPTURE] Failed to open '%s'\n", path);
+        goto fail;
+    }
+
+    can_capture_header_t header = {0};
+    header.magic = CAN_CAPTURE_MAGIC;
+    header.version = CAN_CAPTURE_VERSION;
+    header.record_size = sizeof(can_capture_record_t);
+    header.start_ns = can_clock_now_ns();
+    if (fwrite(&header, sizeof(header), 1, capture->file) != 1)
+    {
+        goto fail;
+    }
+
+    atomic_init(&capture->head, 0);
+    atomic_init(&capture->tail, 0);
+    atomic_init(&capture->dropped, 0);
+    atomic_init(&capture->running, true);
+
+    if (pthread_create(&capture->thread, NULL, can_capture_writer, capture) != 0)
+    {
+        goto fail;
+    }
+
+    return capture;
+
+fail:
+    if (capture->file)
+    {
+        fclose(capture->file);
+    }
+    free(capture->slots);
+    free(capture->buffer);
+    can_aligned_free(capture);
+    return NULL;
+}
+
+// 링에 자리를 예약하고 레코드를 복사 (잠금 없음, 기록 스레드를 기다리지 않음, 기록한 레코드 수 반환)
+int can_capture_append(can_capture_t *capture, uint64_t timestamp_ns, uint16_t iface_idx, const can_frame_t *frames, int n)
+{
+    if (!capture || !frames || n <= 0)
+    {
+        return 0;
+    }
+
+    uint64_t head = atomic_load_explicit(&capture->head, memory_order_relaxed);
+    uint32_t reserved;
+    do
+    {
+        uint64_t used = head - atomic_load_explicit(&capture->tail, memory_order_acquire);
+        uint64_t room = used < CAN_CAPTURE_RING_RECORDS ? CAN_CAPTURE_RING_RECORDS - used : 0;
+        reserved = (uint64_t)n < room ? (uint32_t)n : (uint32_t)room;
+        if (reserved == 0)
+        {
+            break;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&capture->head, &head, head + reserved, memory_order_relaxed, memory_order_relaxed));
+
+    for (uint32_t i = 0; i < reserved; i++)
+    {
+        can_capture_slot_t *slot = &capture->slots[(head + i) & (CAN_CAPTURE_RING_RECORDS - 1)];
+        can_capture_fill_record(&slot->record, timestamp_ns, iface_idx, &frames[i]);
+        atomic_store_explicit(&slot->seq, head + i + 1, memory_order_release);
+    }
+
+    if ((uint32_t)n > reserved)
+    {
+        // 기록 스레드가 따라오지 못함: 송신 경로를 막지 않고 버림
+        atomic_fetch_add_explicit(&capture->dropped, (uint64_t)((uint32_t)n - reserved), memory_order_relaxed);
+    }
+    return (int)reserved;
+}
+
+uint64_t can_capture_dropped(can_capture_t *capture)
+{
+    if (!capture)
+    {
+        return 0;
+    }
+
+    return atomic_load_explicit(&capture->dropped, memory_order_relaxed);
+}
+
+// 남은 레코드를 모두 기록하고 파일을 닫음 (can_capture_append 중인 스레드가 없어야 함)
+void can_capture_close(can_capture_t *capture)
+{
+    if (!capture)
+    {
+        return;
+    }
+
+    atomic_store(&capture->running, false);
+    pthread_join(capture->thread, NULL);
+
+    uint64_t dropped = atomic_load(&capture->dropped);
+    if (dropped > 0)
+    {
+        printf("[CAPTURE] %llu records dropped\n", (unsigned long long)dropped);
+    }
+
+    fclose(capture->file);
+    free(capture->slots);
+    free(capture->buffer);
+    can_aligned_free(capture);
+}
+
+can_error_t can_replay_open(can_replay_t *replay, const char *path)
+{
+    if (!replay || !path)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memset(replay, 0, sizeof(can_replay_t));
+
+#ifdef _WIN32
+    // mmap 이 없으므로 파일 전체를 읽어옴
+    FILE *file = fopen(path, "rb");
+    if (!file)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    void *map = size > 0 ? malloc((size_t)size) : NULL;
+    if (!map || fread(map, 1, (size_t)size, file) != (size_t)size)
+    {
+        free(map);
+        fclose(file);
+        return CAN_ERROR_INIT_FAILED;
+    }
+    fclose(file);
+    size_t map_size = (size_t)size;
+#else
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(can_capture_header_t))
+    {
+        close(fd);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    size_t map_size = (size_t)st.st_size;
+    void *map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    // 앞에서부터 순서대로 읽음
+    madvise(map, map_size, MADV_SEQUENTIAL);
+#endif
+
+    replay->map = map;
+    replay->map_size = map_size;
+
+    const can_capture_header_t *header = map;
+    if (map_size < sizeof(can_capture_header_t) || header->magic != CAN_CAPTURE_MAGIC ||
+        header->version != CAN_CAPTURE_VERSION || header->record_size != sizeof(can_capture_record_t))
+    {
+        printf("[CAPTURE] '%s' is not a capture file\n", path);
+        can_replay_close(replay);
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    // 마지막 레코드가 잘려있으면 (기록 중 종료) 완전한 레코드까지만 사용
+    replay->header = header;
+    replay->records = (const can_capture_record_t *)(header + 1);
+    replay->record_cnt = (map_size - sizeof(can_capture_header_t)) / sizeof(can_capture_record_t);
+
+    return CAN_SUCCESS;
+}
+
+void can_replay_close(can_replay_t *replay)
+{
+    if (!replay || !replay->map)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    free(replay->map);
+#else
+    munmap(replay->map, replay->map_size);
+#endif
+    memset(replay, 0, sizeof(can_replay_t));
+}
+
+void can_replay_to_frame(const can_capture_record_t *record, can_frame_t *frame)
+{
+    memset(frame, 0, sizeof(can_frame_t));
+    frame->id = record->id;
+    frame->dlc = record->dlc > CAN_MAX_DATA_LENGTH ? CAN_MAX_DATA_LENGTH : record->dlc;
+    memcpy(frame->data, record->data, CAN_MAX_DATA_LENGTH);
+    frame->is_extended = (record->flags & CAN_CAPTURE_FLAG_EXTENDED) != 0;
+    frame->is_remote = (record->flags & CAN_CAPTURE_FLAG_REMOTE) != 0;
+    frame->timestamp_ns = record->timestamp_ns;
+}
+
+// 캡처된 메시지를 can_interface 로 다시 송신
+// speed: 1.0 원래 간격, N 배속, CAN_REPLAY_AS_FAST_AS_POSSIBLE 대기 없음
+// 송신한 메시지 수 또는 음수 에러 코드 반환
+int64_t can_replay_run(const can_replay_t *replay, can_interface_t *can_interface, double speed)
+{
+    if (!replay || !replay->records || !can_interface || speed < 0.0)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (replay->record_cnt == 0)
+    {
+        return 0;
+    }
+
+    can_frame_t batch[64];
+    int64_t total = 0;
+    uint64_t first_ts = replay->records[0].timestamp_ns;
+    uint64_t start_ns = can_monotonic_ns();
+    size_t i = 0;
+
+    while (i < replay->record_cnt)
+    {
+        uint64_t now = can_monotonic_ns();
+
+        if (speed > 0.0)
+        {
+            uint64_t due = can_replay_due(start_ns, first_ts, replay->records[i].timestamp_ns, speed);
+            if (due > now)
+            {
+                can_sleep_until_ns(due);
+                now = can_monotonic_ns();
+            }
+        }
+
+        // 송신 시각이 지난 레코드를 묶어서 한 번에 송신
+        int n = 0;
+        while (i < replay->record_cnt && n < 64)
+        {
+            if (speed > 0.0 && n > 0 && can_replay_due(start_ns, first_ts, replay->records[i].timestamp_ns, speed) > now)
+            {
+                break;
+            }
+            can_replay_to_frame(&replay->records[i], &batch[n]);
+            n++;
+            i++;
+        }
+
+        int sent = can_send_batch(can_interface, batch, n);
+        if (sent < 0)
+        {
+            return sent;
+        }
+        total += sent;
+    }
+
+    return total;
+}
+
+// ------------- static method -------------
+// 채워진 레코드를 모아 파일에 기록 (버퍼가 차거나 flush 주기가 되면 기록, 종료 시 남은 레코드까지 기록)
+static void *can_capture_writer(void *arg)
+{
+    can_capture_t *capture = arg;
+    uint64_t flush_due = can_monotonic_ns() + CAN_CAPTURE_FLUSH_MS * 1000000ull;
+    uint32_t fill = 0;
+
+    while (1)
+    {
+        bool running = atomic_load(&capture->running);
+        uint32_t collected = can_capture_collect(capture, fill);
+        fill += collected;
+
+        uint64_t now = can_monotonic_ns();
+        if (fill == CAN_CAPTURE_BUFFER_RECORDS || (fill > 0 && (now >= flush_due || !running)))
+        {
+            if (fwrite(capture->buffer, sizeof(can_capture_record_t), fill, capture->file) != fill)
+            {
+                printf("[CAPTURE] Write failed\n");
+            }
+            fflush(capture->file);
+            fill = 0;
+            flush_due = now + CAN_CAPTURE_FLUSH_MS * 1000000ull;
+            continue;
+        }
+
+        if (!running && collected == 0)
+        {
+            break;
+        }
+
+        if (collected == 0)
+        {
+            can_sleep_until_ns(now + CAN_CAPTURE_IDLE_MS * 1000000ull);
+        }
+    }
+
+    return NULL;
+}
+
+// 앞에서부터 채워진 레코드를 버퍼의 fill 위치 뒤에 복사하고 자리를 반환 (복사한 레코드 수 반환)
+// 예약만 하고 아직 채우지 않은 자리가 있으면 거기서 멈춤
+static uint32_t can_capture_collect(can_capture_t *capture, uint32_t fill)
+{
+    uint64_t tail = atomic_load_explicit(&capture->tail, memory_order_relaxed);
+    uint32_t cnt = 0;
+
+    while (fill + cnt < CAN_CAPTURE_BUFFER_RECORDS)
+    {
+        const can_capture_slot_t *slot = &capture->slots[(tail + cnt) & (CAN_CAPTURE_RING_RECORDS - 1)];
+        if (atomic_load_explicit(&slot->seq, memory_order_acquire) != tail + cnt + 1)
+        {
+            break;
+        }
+        capture->buffer[fill + cnt] = slot->record;
+        cnt++;
+    }
+
+    if (cnt > 0)
+    {
+        atomic_store_explicit(&capture->tail, tail + cnt, memory_order_release);
+    }
+    return cnt;
+}
+
+static void can_capture_fill_record(can_capture_record_t *record, uint64_t timestamp_ns, uint16_t iface_idx, const can_frame_t *frame)
+{
+    record->timestamp_ns = timestamp_ns;
+    record->id = frame->id;
+    record->flags = (frame->is_extended ? CAN_CAPTURE_FLAG_EXTENDED : 0) | (frame->is_remote ? CAN_CAPTURE_FLAG_REMOTE : 0);
+    record->dlc = frame->dlc;
+    record->iface_idx = iface_idx;
+    memcpy(record->data, frame->data, CAN_MAX_DATA_LENGTH);
+}
+
+// 첫 레코드 기준 송신 시각 (동시에 송신한 스레드끼리는 기록 순서와 시각 순서가 다를 수 있으므로 앞선 시각은 바로 송신)
+static uint64_t can_replay_due(uint64_t start_ns, uint64_t first_ts, uint64_t timestamp_ns, double speed)
+{
+    int64_t offset = (int64_t)(timestamp_ns - first_ts);
+    if (offset <= 0)
+    {
+        return start_ns;
+    }
+
+    return start_ns + (uint64_t)((double)offset / speed);
+}
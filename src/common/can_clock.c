@@ -0,0 +1,101 @@
+#include "include/can_clock.h"
+#include "include/can_platform.h"
+#include <stdatomic.h>
+
+static atomic_int g_clock_mode = CAN_CLOCK_REALTIME;
+static _Atomic uint64_t g_virtual_now_ns;
+static uint64_t g_virtual_start_ns;
+static time_t g_virtual_start_wall;
+
+void can_clock_use_realtime(void)
+{
+    atomic_store(&g_clock_mode, CAN_CLOCK_REALTIME);
+}
+
+// 가상 시계로 전환 (start_ns 에서 시작, start_wall: 그 시각의 벽시계 값)
+void can_clock_use_virtual(uint64_t start_ns, time_t start_wall)
+{
+    g_virtual_start_ns = start_ns;
+    g_virtual_start_wall = start_wall;
+    atomic_store(&g_virtual_now_ns, start_ns);
+    atomic_store(&g_clock_mode, CAN_CLOCK_VIRTUAL);
+}
+
+can_clock_mode_t can_clock_mode(void)
+{
+    return (can_clock_mode_t)atomic_load_explicit(&g_clock_mode, memory_order_relaxed);
+}
+
+bool can_clock_is_virtual(void)
+{
+    return can_clock_mode() == CAN_CLOCK_VIRTUAL;
+}
+
+// 현재 시각 (ns, 실시간 모드에서는 can_monotonic_ns 와 같음)
+uint64_t can_clock_now_ns(void)
+{
+    if (can_clock_is_virtual())
+    {
+        return atomic_load_explicit(&g_virtual_now_ns, memory_order_acquire);
+    }
+
+    return can_monotonic_ns();
+}
+
+// 현재 벽시계 시각 (초)
+time_t can_clock_wall_time(void)
+{
+    if (can_clock_is_virtual())
+    {
+        uint64_t elapsed_ns = atomic_load_explicit(&g_virtual_now_ns, memory_order_acquire) - g_virtual_start_ns;
+        return g_virtual_start_wall + (time_t)(elapsed_ns / 1000000000ull);
+    }
+
+    return time(NULL);
+}
+
+// 현재 벽시계 시각 (ns, 프로세스를 다시 시작해도 이어지는 저장용 시각)
+uint64_t can_clock_wall_ns(void)
+{
+    if (can_clock_is_virtual())
+    {
+        uint64_t elapsed_ns = atomic_load_explicit(&g_virtual_now_ns, memory_order_acquire) - g_virtual_start_ns;
+        return (uint64_t)g_virtual_start_wall * 1000000000ull + elapsed_ns;
+    }
+
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 가상 시계를 now_ns 로 옮김 (앞으로만 이동, 실시간 모드이거나 과거 시각이면 false)
+bool can_clock_advance_to(uint64_t now_ns)
+{
+    if (!can_clock_is_virtual())
+    {
+        return false;
+    }
+
+    uint64_t current = atomic_load_explicit(&g_virtual_now_ns, memory_order_relaxed);
+    while (current < now_ns)
+    {
+        if (atomic_compare_exchange_weak_explicit(&g_virtual_now_ns, &current, now_ns, memory_order_release, memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// deadline_ns 까지 대기 (가상 모드: 기다리지 않고 시계를 옮김)
+void can_clock_sleep_until_ns(uint64_t deadline_ns)
+{
+    if (can_clock_is_virtual())
+    {
+        can_clock_advance_to(deadline_ns);
+        return;
+    }
+
+    can_sleep_until_ns(deadline_ns);
+}
@@ -0,0 +1,220 @@
+#include "include/can_epoch.h"
+#include "include/can_platform.h"
+#include <pthread.h>
+#include <sched.h>
+
+// 스레드별 읽기 상태 (스레드가 끝나면 반환되어 다음 스레드가 재사용)
+typedef struct can_epoch_thread
+{
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t active; // 읽기 시작 시점의 epoch (0: 읽는 중 아님)
+    uint32_t depth;                                        // 중첩된 enter 수 (소유 스레드만 사용)
+    atomic_bool in_use;
+    struct can_epoch_thread *next;
+} can_epoch_thread_t;
+
+// 해제 대기 중인 객체 (epoch: 교체된 시점)
+typedef struct
+{
+    void *ptr;
+    uint64_t epoch;
+} can_epoch_retired_t;
+
+static _Atomic uint64_t g_epoch = 1;
+static _Atomic(can_epoch_thread_t *) g_epoch_threads = NULL; // 추가만 하는 목록
+static pthread_once_t g_epoch_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_epoch_key;
+static _Thread_local can_epoch_thread_t *t_epoch = NULL;
+
+static pthread_mutex_t g_retire_lock = PTHREAD_MUTEX_INITIALIZER;
+static can_epoch_retired_t *g_retired = NULL;
+static uint32_t g_retired_cnt = 0;
+static uint32_t g_retired_cap = 0;
+
+static can_epoch_thread_t *can_epoch_self(void);
+static void can_epoch_init_key(void);
+static void can_epoch_release(void *arg);
+static uint64_t can_epoch_min_active(void);
+static void can_epoch_reclaim(void);
+
+// 읽기 시작 (중첩 가능)
+void can_epoch_enter(void)
+{
+    can_epoch_thread_t *self = can_epoch_self();
+    if (!self || self->depth++ > 0)
+    {
+        return;
+    }
+
+    // 표시를 먼저 보이게 한 뒤 포인터를 읽어야 교체한 쪽이 이 스레드를 놓치지 않음
+    atomic_store(&self->active, atomic_load(&g_epoch));
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+void can_epoch_exit(void)
+{
+    can_epoch_thread_t *self = t_epoch;
+    if (!self || self->depth == 0 || --self->depth > 0)
+    {
+        return;
+    }
+
+    atomic_store_explicit(&self->active, 0, memory_order_release);
+}
+
+// 교체되어 더 이상 새로 읽히지 않는 객체를 넘김 (NULL 무시)
+void can_epoch_retire(void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&g_retire_lock);
+
+    if (g_retired_cnt == g_retired_cap)
+    {
+        uint32_t cap = g_retired_cap ? g_retired_cap * 2 : 16;
+        can_epoch_retired_t *retired = realloc(g_retired, sizeof(can_epoch_retired_t) * cap);
+        if (!retired)
+        {
+            // 목록을 늘릴 수 없으면 읽는 스레드가 빠질 때까지 기다렸다가 바로 해제
+            pthread_mutex_unlock(&g_retire_lock);
+            uint64_t epoch = atomic_fetch_add(&g_epoch, 1);
+            while (can_epoch_min_active() <= epoch)
+            {
+                sched_yield();
+            }
+            free(ptr);
+            return;
+        }
+        g_retired = retired;
+        g_retired_cap = cap;
+    }
+
+    g_retired[g_retired_cnt].ptr = ptr;
+    g_retired[g_retired_cnt].epoch = atomic_fetch_add(&g_epoch, 1);
+    g_retired_cnt++;
+
+    can_epoch_reclaim();
+    pthread_mutex_unlock(&g_retire_lock);
+}
+
+// 남은 객체를 모두 해제 (읽는 스레드가 없을 때만 호출)
+void can_epoch_drain(void)
+{
+    pthread_mutex_lock(&g_retire_lock);
+
+    for (uint32_t i = 0; i < g_retired_cnt; i++)
+    {
+        free(g_retired[i].ptr);
+    }
+    free(g_retired);
+    g_retired = NULL;
+    g_retired_cnt = 0;
+    g_retired_cap = 0;
+
+    pthread_mutex_unlock(&g_retire_lock);
+}
+
+// 해제를 기다리는 객체 수
+uint32_t can_epoch_pending(void)
+{
+    pthread_mutex_lock(&g_retire_lock);
+    can_epoch_reclaim();
+    uint32_t cnt = g_retired_cnt;
+    pthread_mutex_unlock(&g_retire_lock);
+    return cnt;
+}
+
+// ------------- static method -------------
+// 호출 스레드의 읽기 상태 (처음 사용할 때 반환된 것을 재사용하거나 새로 할당)
+static can_epoch_thread_t *can_epoch_self(void)
+{
+    if (t_epoch)
+    {
+        return t_epoch;
+    }
+
+    pthread_once(&g_epoch_once, can_epoch_init_key);
+
+    can_epoch_thread_t *self = NULL;
+    for (can_epoch_thread_t *entry = atomic_load(&g_epoch_threads); entry; entry = entry->next)
+    {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&entry->in_use, &expected, true))
+        {
+            self = entry;
+            break;
+        }
+    }
+
+    if (!self)
+    {
+        self = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(can_epoch_thread_t));
+        if (!self)
+        {
+            return NULL;
+        }
+        atomic_init(&self->active, 0);
+        atomic_init(&self->in_use, true);
+
+        self->next = atomic_load(&g_epoch_threads);
+        while (!atomic_compare_exchange_weak(&g_epoch_threads, &self->next, self))
+        {
+        }
+    }
+
+    self->depth = 0;
+    pthread_setspecific(g_epoch_key, self);
+    t_epoch = self;
+    return self;
+}
+
+static void can_epoch_init_key(void)
+{
+    pthread_key_create(&g_epoch_key, can_epoch_release);
+}
+
+// 스레드 종료 시 읽기 상태를 반환
+static void can_epoch_release(void *arg)
+{
+    can_epoch_thread_t *self = arg;
+    self->depth = 0;
+    atomic_store(&self->active, 0);
+    atomic_store_explicit(&self->in_use, false, memory_order_release);
+}
+
+// 읽는 중인 스레드의 가장 오래된 epoch (읽는 스레드가 없으면 UINT64_MAX)
+static uint64_t can_epoch_min_active(void)
+{
+    uint64_t min = UINT64_MAX;
+    for (can_epoch_thread_t *entry = atomic_load(&g_epoch_threads); entry; entry = entry->next)
+    {
+        uint64_t active = atomic_load(&entry->active);
+        if (active != 0 && active < min)
+        {
+            min = active;
+        }
+    }
+    return min;
+}
+
+// 교체 이후에 읽기를 시작한 스레드만 남았으면 해제 (g_retire_lock 보유)
+static void can_epoch_reclaim(void)
+{
+    uint64_t min = can_epoch_min_active();
+    uint32_t kept = 0;
+
+    for (uint32_t i = 0; i < g_retired_cnt; i++)
+    {
+        if (g_retired[i].epoch < min)
+        {
+            free(g_retired[i].ptr);
+        }
+        else
+        {
+            g_retired[kept++] = g_retired[i];
+        }
+    }
+    g_retired_cnt = kept;
+}
@@ -0,0 +1,155 @@
+#include "include/can_filter.h"
+#include <string.h>
+#include <stdlib.h>
+
+static void can_filter_add_extended(can_filter_bank_t *bank, const can_filter_rule_t *rule);
+static int can_filter_range_compare(const void *a, const void *b);
+
+// 규칙 목록을 조회용 뱅크로 컴파일 (규칙이 잘못되었거나 너무 많으면 false)
+bool can_filter_compile(can_filter_bank_t *bank, const can_filter_rule_t *rules, int rule_cnt)
+{
+    if (!bank || (!rules && rule_cnt > 0) || rule_cnt < 0 || rule_cnt > CAN_FILTER_MAX_RULES)
+    {
+        return false;
+    }
+
+    memset(bank, 0, sizeof(can_filter_bank_t));
+
+    for (int i = 0; i < rule_cnt; i++)
+    {
+        const can_filter_rule_t *rule = &rules[i];
+
+        if (rule->type == CAN_FILTER_RULE_RANGE && rule->id > rule->mask)
+        {
+            return false;
+        }
+
+        if (rule->is_extended)
+        {
+            can_filter_add_extended(bank, rule);
+            continue;
+        }
+
+        // 표준 ID: 2048개 ID 를 모두 평가하여 비트맵에 기록
+        for (uint32_t id = 0; id < CAN_STD_ID_COUNT; id++)
+        {
+            bool match;
+            if (rule->type == CAN_FILTER_RULE_MASK)
+            {
+                match = (id & rule->mask) == (rule->id & rule->mask & CAN_STD_ID_MASK);
+            }
+            else
+            {
+                match = id >= rule->id && id <= rule->mask;
+            }
+
+            if (match)
+            {
+                bank->std_bitmap[id >> 6] |= 1ull << (id & 63);
+            }
+        }
+    }
+
+    // 확장 ID 범위 정렬 후 겹치거나 인접한 범위 병합
+    if (bank->ext_range_cnt > 1)
+    {
+        qsort(bank->ext_ranges, bank->ext_range_cnt, sizeof(can_filter_range_t), can_filter_range_compare);
+
+        uint32_t merged = 0;
+        for (uint32_t i = 1; i < bank->ext_range_cnt; i++)
+        {
+            can_filter_range_t *last = &bank->ext_ranges[merged];
+            const can_filter_range_t *curr = &bank->ext_ranges[i];
+
+            if (curr->first <= last->last || curr->first == last->last + 1)
+            {
+                if (curr->last > last->last)
+                {
+                    last->last = curr->last;
+                }
+            }
+            else
+            {
+                bank->ext_ranges[++merged] = *curr;
+            }
+        }
+        bank->ext_range_cnt = merged + 1;
+    }
+
+    return true;
+}
+
+// 확장 ID 판정: 정렬된 범위 테이블 이진 탐색 후 남은 마스크 규칙 검사
+bool can_filter_accept_extended(const can_filter_bank_t *bank, uint32_t id)
+{
+    uint32_t lo = 0;
+    uint32_t hi = bank->ext_range_cnt;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (bank->ext_ranges[mid].last < id)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (lo < bank->ext_range_cnt && bank->ext_ranges[lo].first <= id)
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < bank->ext_mask_cnt; i++)
+    {
+        if ((id & bank->ext_masks[i].mask) == bank->ext_masks[i].id)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ------------- static method -------------
+static void can_filter_add_extended(can_filter_bank_t *bank, const can_filter_rule_t *rule)
+{
+    if (rule->type == CAN_FILTER_RULE_RANGE)
+    {
+        can_filter_range_t *range = &bank->ext_ranges[bank->ext_range_cnt++];
+        range->first = rule->id & CAN_EXT_ID_MASK;
+        range->last = rule->mask & CAN_EXT_ID_MASK;
+        return;
+    }
+
+    uint32_t mask = rule->mask & CAN_EXT_ID_MASK;
+    uint32_t free_bits = ~mask & CAN_EXT_ID_MASK;
+
+    // 하위 비트만 비어있는 마스크(prefix)는 하나의 범위와 동일
+    if ((free_bits & (free_bits + 1)) == 0)
+    {
+        can_filter_range_t *range = &bank->ext_ranges[bank->ext_range_cnt++];
+        range->first = rule->id & mask;
+        range->last = range->first | free_bits;
+        return;
+    }
+
+    can_filter_mask_t *entry = &bank->ext_masks[bank->ext_mask_cnt++];
+    entry->id = rule->id & mask;
+    entry->mask = mask;
+}
+
+static int can_filter_range_compare(const void *a, const void *b)
+{
+    const can_filter_range_t *ra = a;
+    const can_filter_range_t *rb = b;
+
+    if (ra->first != rb->first)
+    {
+        return ra->first < rb->first ? -1 : 1;
+    }
+    return 0;
+}
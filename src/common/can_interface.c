@@ -1,73 +1,232 @@
 #include "include/can_interface.h"
+#include "include/can_registry.h"
+#include "include/can_bus.h"
+#include "include/can_backend.h"
+#include "include/can_ring.h"
+#include "include/can_capture.h"
+#include "include/can_log.h"
+#include "include/can_clock.h"
+#include "include/can_epoch.h"
 #include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
 
 // 전역 CAN 관리자 인스턴스
 can_manager_t g_can_manager = {0};
 
+// 필터 교체 보호 (송수신 경로에서는 사용하지 않음)
+static pthread_mutex_t g_register_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static can_endpoint_t *can_resolve(const can_interface_t *can_interface);
+static can_error_t can_install_filter(can_endpoint_t *endpoint, can_filter_bank_t *bank);
+static void can_capture_frames(const can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+static void can_record_latency(can_endpoint_t *endpoint, const can_frame_t *frames, uint32_t n);
+
 can_error_t can_init_manager(bool debug_mode)
 {
+    can_manager_config_t config = {0};
+    config.debug_mode = debug_mode;
+    config.queue_capacity = CAN_DEFAULT_QUEUE_CAPACITY;
+
+    return can_init_manager_ex(&config);
+}
+
+can_error_t can_init_manager_ex(const can_manager_config_t *config)
+{
+    if (!config)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t capacity = config->queue_capacity ? config->queue_capacity : CAN_DEFAULT_QUEUE_CAPACITY;
+    if (capacity > (1u << 31))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
     memset(&g_can_manager, 0, sizeof(can_manager_t));
-    g_can_manager.debug_mode = debug_mode;
-    g_can_manager.interface_cnt = 0;
-    g_can_manager.global_queue.head = 0;
-    g_can_manager.global_queue.tail = 0;
-    g_can_manager.global_queue.cnt = 0;
+    g_can_manager.debug_mode = config->debug_mode;
+    g_can_manager.queue_capacity = can_next_pow2(capacity);
 
-    if (debug_mode)
+    if (!can_registry_init(g_can_manager.queue_capacity) || !can_bus_init())
     {
-        printf("[CAN] Manager initialized in debug mode\n");
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    if (config->debug_mode)
+    {
+        // 메시지 추적은 포맷 스레드에서 출력 (송수신 경로에서는 레코드만 복사)
+        can_log_set_level(CAN_LOG_CAT_FRAME, CAN_LOG_DEBUG);
+        can_log_start(NULL);
+        printf("[CAN] Manager initialized in debug mode (queue capacity: %u)\n", g_can_manager.queue_capacity);
     }
 
     return CAN_SUCCESS;
 }
 
-// CAN 인터페이스 생성
+// CAN 인터페이스 생성 (관리자가 본체를 소유하고 can_interface 에는 핸들만 기록)
 can_error_t can_create_interface(can_interface_t *can_interface, const char *name, uint32_t node_id)
 {
-    if (!can_interface || !name)
+    return can_create_interface_on_bus(can_interface, name, node_id, CAN_DEFAULT_BUS);
+}
+
+// bus_id 버스에 인터페이스 생성 (같은 버스의 인터페이스끼리만 메시지를 주고받음)
+can_error_t can_create_interface_on_bus(can_interface_t *can_interface, const char *name, uint32_t node_id, uint32_t bus_id)
+{
+    can_interface_config_t config = {0};
+    config.bus_id = bus_id;
+    config.backend = CAN_BACKEND_MEMORY;
+
+    return can_create_interface_ex(can_interface, name, node_id, &config);
+}
+
+// 백엔드를 골라 인터페이스 생성 (SocketCAN 은 버스 대신 config->device 장치에 연결)
+can_error_t can_create_interface_ex(can_interface_t *can_interface, const char *name, uint32_t node_id, const can_interface_config_t *config)
+{
+    if (!can_interface || !name || !config)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    const can_backend_t *backend = can_backend_get(config->backend);
+    can_bus_t *bus = can_bus_get(config->bus_id);
+    if (!backend || !bus)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    if (g_can_manager.interface_cnt >= CAN_MAX_INTERFACES)
+    bool with_tx_queue = backend == &g_can_memory_backend && bus->has_worker;
+    can_endpoint_t *endpoint = can_registry_open(name, node_id, config->bus_id, with_tx_queue, backend);
+    if (!endpoint)
     {
-        printf("[CAN] MAximum interfaces reached\n");
+        printf("[CAN] Failed to create interface '%s'\n", name);
         return CAN_ERROR_INIT_FAILED;
     }
+    snprintf(endpoint->device, sizeof(endpoint->device), "%s", config->device ? config->device : name);
 
     memset(can_interface, 0, sizeof(can_interface_t));
-    strncpy(can_interface->interface_name, name, sizeof(can_interface->interface_name));
+    memcpy(can_interface->interface_name, endpoint->interface_name, sizeof(can_interface->interface_name));
     can_interface->node_id = node_id;
-    can_interface->is_connected = false;
-    can_interface->filter_enabled = false;
+    can_interface->handle = atomic_load(&endpoint->handle);
 
-    // 관리자에 등록
-    g_can_manager.interfaces[g_can_manager.interface_cnt] = *can_interface;
-    g_can_manager.interface_cnt++;
+    if (g_can_manager.debug_mode)
+    {
+        printf("[CAN] Interface '%s' is created (Node ID: 0x%03X, backend: %s, bus: %s)\n", name, node_id, backend->name, bus->name);
+    }
+
+    return CAN_SUCCESS;
+}
+
+// 인터페이스 해제 (같은 핸들을 가진 모든 복사본이 무효가 됨)
+can_error_t can_destroy_interface(can_interface_t *can_interface)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    can_disconnect(can_interface);
+    endpoint->backend->close(endpoint);
+    can_install_filter(endpoint, NULL);
+
+#ifdef __linux__
+    int fd = atomic_exchange(&endpoint->event_fd, -1);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+#endif
+
+    if (!can_registry_close(can_interface->handle))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
 
     if (g_can_manager.debug_mode)
     {
-        printf("[CAN] Interface '%s' is created (Node ID: 0x%03X)\n", name, node_id);
+        printf("[CAN] Interface '%s' is destroyed\n", can_interface->interface_name);
     }
 
+    can_interface->handle = CAN_INVALID_HANDLE;
     return CAN_SUCCESS;
 }
 
-can_error_t can_connect(can_interface_t *can_interface)
+// 이름으로 등록된 인터페이스 조회
+can_error_t can_find_interface(const char *name, can_interface_t *can_interface)
+{
+    if (!name || !can_interface)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    return can_attach_interface(can_registry_find(name), can_interface);
+}
+
+// 핸들로 인터페이스 조회 (세대가 다르면 실패)
+can_error_t can_attach_interface(can_handle_t handle, can_interface_t *can_interface)
 {
     if (!can_interface)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    can_interface->is_connected = true;
-    can_interface->tx_cnt = 0;
-    can_interface->rx_cnt = 0;
-    can_interface->err_cnt = 0;
+    can_endpoint_t *endpoint = can_registry_get(handle);
+    if (!endpoint)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    memset(can_interface, 0, sizeof(can_interface_t));
+    memcpy(can_interface->interface_name, endpoint->interface_name, sizeof(can_interface->interface_name));
+    can_interface->node_id = endpoint->node_id;
+    can_interface->handle = handle;
+    return CAN_SUCCESS;
+}
+
+bool can_is_connected(const can_interface_t *can_interface)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    return endpoint && atomic_load(&endpoint->is_connected);
+}
+
+int can_interface_count(void)
+{
+    can_epoch_enter();
+    const can_subscribers_t *subscribers = can_registry_subscribers();
+    int cnt = subscribers ? subscribers->cnt : 0;
+    can_epoch_exit();
+    return cnt;
+}
+
+can_error_t can_connect(can_interface_t *can_interface)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    can_error_t result = endpoint->backend->open(endpoint);
+    if (result != CAN_SUCCESS)
+    {
+        return result;
+    }
+
+    atomic_store(&endpoint->is_connected, true);
+    can_metrics_reset(&endpoint->metrics);
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; i++)
+    {
+        atomic_store_explicit(&endpoint->latency_hist[i], 0, memory_order_relaxed);
+    }
 
     if (g_can_manager.debug_mode)
     {
-        printf("[CAN] Interface '%s' is connected\n", can_interface->interface_name);
+        printf("[CAN] Interface '%s' is connected\n", endpoint->interface_name);
     }
 
     return CAN_SUCCESS;
@@ -75,16 +234,23 @@ can_error_t can_connect(can_interface_t *can_interface)
 
 can_error_t can_disconnect(can_interface_t *can_interface)
 {
-    if (!can_interface)
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    can_interface->is_connected = false;
+    atomic_store(&endpoint->is_connected, false);
+
+    // 블로킹 수신 중인 스레드를 깨워 연결 해제를 알림
+    if (endpoint->rx_queue)
+    {
+        can_ring_wake(endpoint->rx_queue);
+    }
 
     if (g_can_manager.debug_mode)
     {
-        printf("[CAN] Interface '%s' is disconnected\n", can_interface->interface_name);
+        printf("[CAN] Interface '%s' is disconnected\n", endpoint->interface_name);
     }
 
     return CAN_SUCCESS;
@@ -97,46 +263,67 @@ can_error_t can_send(can_interface_t *can_interface, const can_frame_t *frame)
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    if (!can_interface->is_connected)
+    int sent = can_send_batch(can_interface, frame, 1);
+    if (sent < 0)
     {
-        return CAN_ERROR_NOT_CONNECTED;
+        return (can_error_t)sent;
     }
 
-    if (frame->dlc > CAN_MAX_DATA_LENGTH)
+    return sent == 1 ? CAN_SUCCESS : CAN_ERROR_QUEUE_FULL;
+}
+
+// 여러 메시지를 한 번에 송신 (버스에 올라간 메시지 수 또는 음수 에러 코드 반환)
+// 워커가 있는 버스에서는 송신 큐에 적재된 메시지 수
+int can_send_batch(can_interface_t *can_interface, const can_frame_t *frames, int n)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint || !frames || n < 0)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    // 전역 큐에 메시지 추가
-    can_message_queue_t *queue = &g_can_manager.global_queue;
+    if (!atomic_load(&endpoint->is_connected))
+    {
+        return CAN_ERROR_NOT_CONNECTED;
+    }
 
-    if (queue->cnt >= CAN_MESSAGE_QUEUE_SIZE)
+    for (int i = 0; i < n; i++)
     {
-        can_interface->err_cnt++;
-        return CAN_ERROR_QUEUE_FULL;
+        if (frames[i].dlc > CAN_MAX_DATA_LENGTH)
+        {
+            return CAN_ERROR_INVALID_PARAM;
+        }
     }
 
-    // 메시지 복사 및 타임스탬프 추가
-    can_frame_t *msg = &queue->messages[queue->head];
-    *msg = *frame;
-    // GetCurrentTime(&msg->timestamp);
+    // 메모리 백엔드는 같은 버스의 인터페이스에만 배달 (워커가 있는 버스는 송신 큐에 적재만 함)
+    // 배달 중 읽는 필터 뱅크는 can_epoch 구간 안에서만 사용
+    uint64_t timestamp_ns = can_clock_now_ns();
+    can_epoch_enter();
+    int sent = endpoint->backend->send(endpoint, frames, n, timestamp_ns);
+    can_epoch_exit();
+    if (sent < 0)
+    {
+        return sent;
+    }
 
-    queue->head = (queue->head + 1) % CAN_MESSAGE_QUEUE_SIZE;
-    queue->cnt++;
+    can_metrics_add(&endpoint->metrics, CAN_METRIC_TX_FRAMES, (uint64_t)sent);
+    can_metrics_add(&endpoint->metrics, CAN_METRIC_TX_ERRORS, (uint64_t)(n - sent));
 
-    can_interface->tx_cnt++;
+    // 백엔드가 받아들인 메시지만 기록
+    can_capture_frames(endpoint, frames, sent, timestamp_ns);
 
-    if (g_can_manager.debug_mode)
+    if (can_log_enabled(CAN_LOG_CAT_FRAME, CAN_LOG_DEBUG))
     {
-        printf("[CAN TX] %s: ID=0x%03X, DLC=%d, DATA= ", can_interface->interface_name, frame->id, frame->dlc);
-        for (int i = 0; i < frame->dlc; i++)
+        // 캡처와 같은 메시지를 백엔드가 찍은 시각으로 기록
+        for (int i = 0; i < sent; i++)
         {
-            printf("%02X ", frame->data[i]);
+            can_frame_t frame = frames[i];
+            frame.timestamp_ns = timestamp_ns;
+            can_log_frame(CAN_LOG_CAT_FRAME, CAN_LOG_DEBUG, "TX", endpoint->interface_name, &frame);
         }
-        printf("\n");
     }
 
-    return CAN_SUCCESS;
+    return sent;
 }
 
 can_error_t can_receive(can_interface_t *can_interface, can_frame_t *frame, int timeout_ms)
@@ -146,110 +333,309 @@ can_error_t can_receive(can_interface_t *can_interface, can_frame_t *frame, int
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    if (!can_interface->is_connected)
+    int received = can_receive_batch(can_interface, frame, 1, timeout_ms);
+    if (received < 0)
+    {
+        return (can_error_t)received;
+    }
+
+    return CAN_SUCCESS;
+}
+
+// 쌓인 메시지를 최대 max 개까지 한 번에 수신 (수신한 메시지 수 또는 음수 에러 코드 반환)
+int can_receive_batch(can_interface_t *can_interface, can_frame_t *frames, int max, int timeout_ms)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint || !frames || max <= 0)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (!atomic_load(&endpoint->is_connected))
     {
         return CAN_ERROR_NOT_CONNECTED;
     }
 
-    can_message_queue_t *queue = &g_can_manager.global_queue;
+    int received = endpoint->backend->receive(endpoint, frames, max, timeout_ms);
+    if (received <= 0)
+    {
+        return received < 0 ? received : CAN_ERROR_RECV_FAILED;
+    }
 
-    // 타임아웃 처리를 위한 시작 시간
-    struct timespec start_time, current_time;
-    // GetCurrentTime(&start_time);
+    can_metrics_add(&endpoint->metrics, CAN_METRIC_RX_FRAMES, (uint64_t)received);
+    can_record_latency(endpoint, frames, (uint32_t)received);
 
-    while (1)
+    if (can_log_enabled(CAN_LOG_CAT_FRAME, CAN_LOG_DEBUG))
     {
-        // 큐에서 메시지 검색
-        for (int i = 0; i < queue->cnt; i++)
+        for (int i = 0; i < received; i++)
         {
-            int idx = (queue->tail + i) % CAN_MESSAGE_QUEUE_SIZE;
-            can_frame_t *msg = &queue->messages[idx];
-
-            // 필터 검사
-            bool pass_filter = true;
-            if (can_interface->filter_enabled)
-            {
-                pass_filter = ((msg->id & can_interface->filter_mask) == (can_interface->filter_id & can_interface->filter_mask));
-            }
-
-            // 자신이 보낸 메시지는 제외 (실제 CAN에서는 가능)
-            bool is_own_message = false;
-            // 간단한 방법: node id 기반으로 판단 (실제로는 더 복잡한 로직 필요)
-
-            if (pass_filter && !is_own_message)
-            {
-                *frame = *msg;
-
-                // 큐에서 메시지 제거 (해당 위치부터 앞으로 이동)
-                for (int j = i; j < queue->cnt - 1; j++)
-                {
-                    int curr_idx = (queue->tail + j) % CAN_MESSAGE_QUEUE_SIZE;
-                    int next_idx = (queue->tail + j + 1) % CAN_MESSAGE_QUEUE_SIZE;
-                    queue->messages[curr_idx] = queue->messages[next_idx];
-                }
-                queue->cnt--;
-
-                can_interface->rx_cnt++;
-
-                if (g_can_manager.debug_mode)
-                {
-                    printf("[CAN RX] %s: ID=0x%03X, DLC=%d, DATA= ", can_interface->interface_name, frame->id, frame->dlc);
-                    for (int k = 0; k < frame->dlc; k++)
-                    {
-                        printf("%02X ", frame->data[k]);
-                    }
-                    printf("\n");
-                }
-                return CAN_SUCCESS;
-            }
+            can_log_frame(CAN_LOG_CAT_FRAME, CAN_LOG_DEBUG, "RX", endpoint->interface_name, &frames[i]);
         }
+    }
+    return received;
+}
 
-        if (timeout_ms > 0)
-        {
-            // GetCurrentTime(&current_time);
+// epoll 등에 등록할 수 있는 수신 알림 핸들 (받을 메시지가 있으면 readable)
+int can_get_event_fd(can_interface_t *can_interface)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint)
+    {
+        return -1;
+    }
 
-            long elasped_ms = (current_time.tv_sec - start_time.tv_sec) * 1000 + (current_time.tv_nsec - start_time.tv_nsec) / 1000000;
+    return endpoint->backend->event_fd(endpoint);
+}
 
-            if (elasped_ms >= timeout_ms)
-            {
-                return CAN_ERROR_RECV_FAILED;
-            }
+can_error_t can_set_filter(can_interface_t *can_interface, uint32_t id, uint32_t mask)
+{
+    if (!can_interface)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    can_filter_rule_t rule = can_filter_mask_rule(id, mask, id > CAN_STD_ID_MASK);
+    can_error_t result = can_set_filter_bank(can_interface, &rule, 1);
+
+    if (result == CAN_SUCCESS && g_can_manager.debug_mode)
+    {
+        printf("[CAN] Filter Set for '%s': ID=0x%03X, Mask=0x%03X\n", can_interface->interface_name, id, mask);
+    }
+
+    return result;
+}
+
+// 여러 id/mask, 범위 규칙을 하나의 필터 뱅크로 컴파일하여 설치
+can_error_t can_set_filter_bank(can_interface_t *can_interface, const can_filter_rule_t *rules, int rule_cnt)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint || (!rules && rule_cnt > 0) || rule_cnt < 0 || rule_cnt > CAN_FILTER_MAX_RULES)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    can_filter_bank_t *bank = malloc(sizeof(can_filter_bank_t));
+    if (!bank)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    if (!can_filter_compile(bank, rules, rule_cnt))
+    {
+        free(bank);
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (g_can_manager.debug_mode)
+    {
+        printf("[CAN] Filter bank set for '%s': %d rules\n", endpoint->interface_name, rule_cnt);
+    }
+
+    return can_install_filter(endpoint, bank);
+}
+
+can_error_t can_clear_filter(can_interface_t *can_interface)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    return can_install_filter(endpoint, NULL);
+}
+
+can_error_t can_get_latency_histogram(const can_interface_t *can_interface, can_latency_hist_t *hist)
+{
+    can_endpoint_t *endpoint = can_resolve(can_interface);
+    if (!endpoint || !hist)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    can_endpoint_latency(endpoint, hist);
+
+    return CAN_SUCCESS;
+}
+
+// percentile(0~100) 이 속한 구간의 상한값 (ns)
+uint64_t can_latency_percentile(const can_latency_hist_t *hist, double percentile)
+{
+    if (!hist || hist->count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)((double)hist->count * percentile / 100.0);
+    if (rank >= hist->count)
+    {
+        rank = hist->count - 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; i++)
+    {
+        seen += hist->buckets[i];
+        if (seen > rank)
+        {
+            return i == CAN_LATENCY_BUCKETS - 1 ? UINT64_MAX : (2ull << i) - 1;
         }
-        else if (timeout_ms == 0)
+    }
+
+    return UINT64_MAX;
+}
+
+// 등록된 인터페이스별 지연 분포 출력
+void can_print_latency_report(void)
+{
+    can_epoch_enter();
+    const can_subscribers_t *subscribers = can_registry_subscribers();
+    for (int i = 0; subscribers && i < subscribers->cnt; i++)
+    {
+        can_latency_hist_t hist;
+        can_endpoint_latency(subscribers->endpoints[i], &hist);
+        if (hist.count == 0)
         {
-            return CAN_ERROR_RECV_FAILED;
+            continue;
         }
 
-        // _sleep(100);
+        printf("[CAN] Latency '%s': count=%llu p50<%lluns p99<%lluns p99.9<%lluns\n",
+               subscribers->endpoints[i]->interface_name,
+               (unsigned long long)hist.count,
+               (unsigned long long)can_latency_percentile(&hist, 50.0),
+               (unsigned long long)can_latency_percentile(&hist, 99.0),
+               (unsigned long long)can_latency_percentile(&hist, 99.9));
     }
+    can_epoch_exit();
 }
 
-can_error_t can_set_filter(can_interface_t *can_interface, uint32_t id, uint32_t mask)
+// 이후 송신되는 모든 메시지를 path 에 기록 (이미 캡처 중이면 실패)
+can_error_t can_start_capture(const char *path)
 {
-    if (!can_interface)
+    if (!path)
     {
         return CAN_ERROR_INVALID_PARAM;
     }
 
-    can_interface->filter_id = id;
-    can_interface->filter_mask = mask;
-    can_interface->filter_enabled = true;
+    can_capture_t *capture = can_capture_open(path);
+    if (!capture)
+    {
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    can_capture_t *expected = NULL;
+    if (!atomic_compare_exchange_strong(&g_can_manager.capture, &expected, capture))
+    {
+        can_capture_close(capture);
+        return CAN_ERROR_INIT_FAILED;
+    }
 
     if (g_can_manager.debug_mode)
     {
-        printf("[CAN] Filter Set for '%s': ID=0x%03X, Mask=0x%03X\n", can_interface->interface_name, id, mask);
+        printf("[CAN] Capture started: %s\n", path);
     }
 
     return CAN_SUCCESS;
 }
 
+void can_stop_capture(void)
+{
+    can_capture_t *capture = atomic_exchange(&g_can_manager.capture, NULL);
+    if (!capture)
+    {
+        return;
+    }
+
+    // 포인터를 읽어간 송신 스레드가 기록을 마칠 때까지 대기
+    while (atomic_load(&g_can_manager.capture_users) > 0)
+    {
+        sched_yield();
+    }
+
+    can_capture_close(capture);
+
+    if (g_can_manager.debug_mode)
+    {
+        printf("[CAN] Capture stopped\n");
+    }
+}
+
 void can_cleanup_manager(void)
 {
-    for (int i = 0; i < g_can_manager.interface_cnt; i++)
+    can_stop_capture();
+
+    // 남은 로그를 먼저 출력 (이후 로그는 호출 스레드에서 바로 출력)
+    can_log_stop();
+
+    // 블로킹 수신 중인 스레드를 깨운 뒤 모든 인터페이스 해제
+    const can_subscribers_t *subscribers = can_registry_subscribers();
+    for (int i = 0; subscribers && i < subscribers->cnt; i++)
     {
-        can_disconnect(&g_can_manager.interfaces[i]);
+        can_endpoint_t *endpoint = subscribers->endpoints[i];
+        atomic_store(&endpoint->is_connected, false);
+        can_ring_wake(endpoint->rx_queue);
+        endpoint->backend->close(endpoint);
     }
+    can_bus_cleanup();
+    can_registry_cleanup();
+
     memset(&g_can_manager, 0, sizeof(g_can_manager));
 
     printf("[CAN] Manager cleanded up\n");
-}
\ No newline at end of file
+}
+
+// ------------- static method -------------
+// 핸들이 가리키는 엔드포인트 (해제되었거나 세대가 다르면 NULL)
+static can_endpoint_t *can_resolve(const can_interface_t *can_interface)
+{
+    return can_interface ? can_registry_get(can_interface->handle) : NULL;
+}
+
+// 필터 뱅크 교체 (송신 중인 스레드가 읽고 있을 수 있으므로 이전 뱅크는 읽던 스레드가 모두 빠져나간 뒤 해제)
+static can_error_t can_install_filter(can_endpoint_t *endpoint, can_filter_bank_t *bank)
+{
+    pthread_mutex_lock(&g_register_lock);
+
+    // 먼저 게시한 뒤 백엔드에 반영 (동시에 장치를 여는 백엔드는 핸들을 게시한 뒤 endpoint->filter 를 다시 읽으므로 놓치지 않음)
+    can_filter_bank_t *old = atomic_exchange(&endpoint->filter, bank);
+
+    if (endpoint->backend->set_filter)
+    {
+        endpoint->backend->set_filter(endpoint, bank);
+    }
+
+    can_epoch_retire(old);
+
+    pthread_mutex_unlock(&g_register_lock);
+    return CAN_SUCCESS;
+}
+
+// 캡처 중일 때만 사용자 수를 올려 기록 (캡처하지 않으면 포인터 읽기 한 번)
+static void can_capture_frames(const can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    if (!atomic_load_explicit(&g_can_manager.capture, memory_order_relaxed))
+    {
+        return;
+    }
+
+    atomic_fetch_add(&g_can_manager.capture_users, 1);
+    can_capture_t *capture = atomic_load(&g_can_manager.capture);
+    if (capture)
+    {
+        can_capture_append(capture, timestamp_ns, (uint16_t)endpoint->index, frames, n);
+    }
+    atomic_fetch_sub(&g_can_manager.capture_users, 1);
+}
+
+// 수신 시각과 송신 시각의 차이를 log2 구간에 누적
+static void can_record_latency(can_endpoint_t *endpoint, const can_frame_t *frames, uint32_t n)
+{
+    uint64_t now = can_clock_now_ns();
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint64_t latency = now > frames[i].timestamp_ns ? now - frames[i].timestamp_ns : 0;
+        int bucket = 63 - __builtin_clzll(latency | 1);
+        atomic_fetch_add_explicit(&endpoint->latency_hist[bucket], 1, memory_order_relaxed);
+    }
+}
@@ -0,0 +1,327 @@
+#include "include/can_log.h"
+#include "include/can_platform.h"
+#include <pthread.h>
+#include <string.h>
+
+// 스레드별 단일 생산자/단일 소비자 링 (생산자: 로그를 남기는 스레드, 소비자: 포맷 스레드)
+// 스레드가 끝나면 링을 반환하고 다음에 시작한 스레드가 이어서 씀 (링 수는 동시에 로그를 남긴 스레드 수까지만 늘어남)
+typedef struct can_log_ring
+{
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t head; // 생산자가 다음에 쓸 위치
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t tail; // 소비자가 다음에 읽을 위치
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t dropped;
+    atomic_bool in_use; // 생산자 스레드가 있는지 여부
+    struct can_log_ring *next;
+    can_log_record_t records[CAN_LOG_RING_SIZE];
+} can_log_ring_t;
+
+_Atomic uint8_t g_can_log_levels[CAN_LOG_CAT_COUNT] = {CAN_LOG_INFO, CAN_LOG_INFO, CAN_LOG_INFO, CAN_LOG_INFO};
+
+static pthread_mutex_t g_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic(can_log_ring_t *) g_log_rings = NULL;
+static _Thread_local can_log_ring_t *t_log_ring = NULL;
+static pthread_once_t g_log_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_log_key;
+static pthread_t g_log_thread;
+static atomic_bool g_log_running = false;
+static _Atomic(FILE *) g_log_out = NULL; // 포맷 스레드가 멈춘 뒤에도 유지
+
+static void can_log_emit(const can_log_record_t *record);
+static FILE *can_log_out(void);
+static void can_log_drain_stopped(void);
+static can_log_ring_t *can_log_thread_ring(void);
+static void can_log_init_key(void);
+static void can_log_release_ring(void *arg);
+static void *can_log_formatter(void *arg);
+static bool can_log_drain(FILE *out);
+static void can_log_format(FILE *out, const can_log_record_t *record);
+
+void can_log_set_level(can_log_category_t category, can_log_level_t level)
+{
+    if (category >= CAN_LOG_CAT_COUNT)
+    {
+        return;
+    }
+
+    atomic_store_explicit(&g_can_log_levels[category], (uint8_t)level, memory_order_relaxed);
+}
+
+// 포맷 스레드 시작 (out 이 NULL 이면 stdout, 이미 실행 중이면 true)
+bool can_log_start(FILE *out)
+{
+    pthread_mutex_lock(&g_log_lock);
+
+    if (atomic_load(&g_log_running))
+    {
+        pthread_mutex_unlock(&g_log_lock);
+        return true;
+    }
+
+    atomic_store(&g_log_out, out ? out : stdout);
+    atomic_store(&g_log_running, true);
+    if (pthread_create(&g_log_thread, NULL, can_log_formatter, NULL) != 0)
+    {
+        atomic_store(&g_log_running, false);
+        pthread_mutex_unlock(&g_log_lock);
+        return false;
+    }
+
+    pthread_mutex_unlock(&g_log_lock);
+    return true;
+}
+
+// 남은 레코드를 모두 출력하고 포맷 스레드 종료 (이후 로그는 호출 스레드에서 같은 출력으로 바로 출력)
+void can_log_stop(void)
+{
+    pthread_mutex_lock(&g_log_lock);
+
+    if (!atomic_exchange(&g_log_running, false))
+    {
+        pthread_mutex_unlock(&g_log_lock);
+        return;
+    }
+
+    pthread_join(g_log_thread, NULL);
+    pthread_mutex_unlock(&g_log_lock);
+}
+
+// 링이 가득 차서 버린 레코드 수
+uint64_t can_log_dropped(void)
+{
+    uint64_t dropped = 0;
+    for (can_log_ring_t *ring = atomic_load(&g_log_rings); ring; ring = ring->next)
+    {
+        dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    }
+    return dropped;
+}
+
+// text 는 printf 형식 (인자는 %llu, %llx 등 64비트로), 줄바꿈은 자동으로 붙음
+void can_log_write(can_log_category_t category, can_log_level_t level, const char *text, uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3)
+{
+    if (category >= CAN_LOG_CAT_COUNT || !text || !can_log_enabled(category, level))
+    {
+        return;
+    }
+
+    can_log_record_t record;
+    record.timestamp_ns = can_monotonic_ns();
+    record.format = CAN_LOG_FMT_MESSAGE;
+    record.category = (uint8_t)category;
+    record.level = (uint8_t)level;
+    record.text = text;
+    record.name[0] = '\0';
+    record.args[0] = a0;
+    record.args[1] = a1;
+    record.args[2] = a2;
+    record.args[3] = a3;
+
+    can_log_emit(&record);
+}
+
+// 메시지 추적 (데이터는 8바이트를 그대로 복사, 포맷은 포맷 스레드에서)
+void can_log_frame(can_log_category_t category, can_log_level_t level, const char *direction, const char *name, const can_frame_t *frame)
+{
+    if (category >= CAN_LOG_CAT_COUNT || !frame || !can_log_enabled(category, level))
+    {
+        return;
+    }
+
+    can_log_record_t record;
+    record.timestamp_ns = can_monotonic_ns();
+    record.format = CAN_LOG_FMT_FRAME;
+    record.category = (uint8_t)category;
+    record.level = (uint8_t)level;
+    record.text = direction;
+    snprintf(record.name, sizeof(record.name), "%s", name ? name : "?");
+    record.args[0] = frame->id;
+    record.args[1] = (uint64_t)frame->dlc | ((uint64_t)frame->is_extended << 8) | ((uint64_t)frame->is_remote << 9);
+    memcpy(&record.args[2], frame->data, CAN_MAX_DATA_LENGTH);
+    record.args[3] = frame->timestamp_ns;
+
+    can_log_emit(&record);
+}
+
+// ------------- static method -------------
+static void can_log_emit(const can_log_record_t *record)
+{
+    if (!atomic_load_explicit(&g_log_running, memory_order_relaxed))
+    {
+        // 포맷 스레드가 없으면 설정된 출력으로 바로 출력
+        can_log_format(can_log_out(), record);
+        return;
+    }
+
+    can_log_ring_t *ring = can_log_thread_ring();
+    if (!ring)
+    {
+        return;
+    }
+
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= CAN_LOG_RING_SIZE)
+    {
+        // 링이 가득 참: 호출 스레드를 막지 않고 버림
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    ring->records[head & (CAN_LOG_RING_SIZE - 1)] = *record;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    // 적재하는 사이 포맷 스레드가 마지막 출력을 끝냈으면 남은 레코드를 직접 출력 (포맷 스레드의 펜스와 짝)
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!atomic_load_explicit(&g_log_running, memory_order_relaxed))
+    {
+        can_log_drain_stopped();
+    }
+}
+
+// 설정된 출력 (한 번도 시작하지 않았으면 stdout)
+static FILE *can_log_out(void)
+{
+    FILE *out = atomic_load(&g_log_out);
+    return out ? out : stdout;
+}
+
+// 포맷 스레드 없이 남은 레코드 출력 (can_log_stop 이 잠금을 쥔 채 종료를 기다리므로 포맷 스레드와 겹치지 않음)
+static void can_log_drain_stopped(void)
+{
+    pthread_mutex_lock(&g_log_lock);
+
+    if (!atomic_load(&g_log_running))
+    {
+        FILE *out = can_log_out();
+        while (can_log_drain(out))
+        {
+        }
+        fflush(out);
+    }
+
+    pthread_mutex_unlock(&g_log_lock);
+}
+
+// 호출 스레드의 링 (처음 사용할 때 반환된 링을 이어 쓰거나 새로 할당하여 목록에 등록)
+static can_log_ring_t *can_log_thread_ring(void)
+{
+    if (t_log_ring)
+    {
+        return t_log_ring;
+    }
+
+    pthread_once(&g_log_once, can_log_init_key);
+
+    can_log_ring_t *ring = NULL;
+    for (can_log_ring_t *entry = atomic_load(&g_log_rings); entry; entry = entry->next)
+    {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&entry->in_use, &expected, true))
+        {
+            ring = entry;
+            break;
+        }
+    }
+
+    if (!ring)
+    {
+        ring = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(can_log_ring_t));
+        if (!ring)
+        {
+            return NULL;
+        }
+
+        atomic_init(&ring->head, 0);
+        atomic_init(&ring->tail, 0);
+        atomic_init(&ring->dropped, 0);
+        atomic_init(&ring->in_use, true);
+
+        pthread_mutex_lock(&g_log_lock);
+        ring->next = atomic_load(&g_log_rings);
+        atomic_store(&g_log_rings, ring);
+        pthread_mutex_unlock(&g_log_lock);
+    }
+
+    pthread_setspecific(g_log_key, ring);
+    t_log_ring = ring;
+    return ring;
+}
+
+static void can_log_init_key(void)
+{
+    pthread_key_create(&g_log_key, can_log_release_ring);
+}
+
+// 스레드 종료 시 링 반환 (남은 레코드는 포맷 스레드가 그대로 출력)
+static void can_log_release_ring(void *arg)
+{
+    can_log_ring_t *ring = arg;
+    atomic_store_explicit(&ring->in_use, false, memory_order_release);
+}
+
+static void *can_log_formatter(void *arg)
+{
+    (void)arg;
+    FILE *out = atomic_load(&g_log_out);
+
+    while (atomic_load(&g_log_running))
+    {
+        if (!can_log_drain(out))
+        {
+            can_sleep_until_ns(can_monotonic_ns() + CAN_LOG_IDLE_MS * 1000000ull);
+        }
+    }
+
+    // 종료 전 남은 레코드 출력 (이후 적재된 레코드는 적재한 스레드가 직접 출력)
+    atomic_thread_fence(memory_order_seq_cst);
+    while (can_log_drain(out))
+    {
+    }
+    fflush(out);
+
+    return NULL;
+}
+
+// 모든 링의 레코드를 출력 (출력한 레코드가 있으면 true)
+static bool can_log_drain(FILE *out)
+{
+    bool drained = false;
+
+    for (can_log_ring_t *ring = atomic_load(&g_log_rings); ring; ring = ring->next)
+    {
+        uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+        for (; tail != head; tail++)
+        {
+            can_log_format(out, &ring->records[tail & (CAN_LOG_RING_SIZE - 1)]);
+            drained = true;
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+
+    return drained;
+}
+
+static void can_log_format(FILE *out, const can_log_record_t *record)
+{
+    if (record->format == CAN_LOG_FMT_FRAME)
+    {
+        uint8_t data[CAN_MAX_DATA_LENGTH];
+        uint32_t dlc = (uint32_t)(record->args[1] & 0xFF);
+        memcpy(data, &record->args[2], CAN_MAX_DATA_LENGTH);
+
+        fprintf(out, "[CAN %s] %s: ID=0x%03X, DLC=%u, DATA= ", record->text, record->name,
+                (unsigned int)record->args[0], dlc);
+        for (uint32_t i = 0; i < dlc && i < CAN_MAX_DATA_LENGTH; i++)
+        {
+            fprintf(out, "%02X ", data[i]);
+        }
+        fputc('\n', out);
+        return;
+    }
+
+    fprintf(out, record->text, (unsigned long long)record->args[0], (unsigned long long)record->args[1],
+            (unsigned long long)record->args[2], (unsigned long long)record->args[3]);
+    fputc('\n', out);
+}
@@ -0,0 +1,306 @@
+#include "include/can_metrics.h"
+#include "include/can_interface.h"
+#include "include/can_registry.h"
+#include "include/can_ring.h"
+#include "include/can_epoch.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+_Atomic uint64_t g_can_id_frames[CAN_METRICS_SHARDS][CAN_METRICS_ID_SLOTS];
+_Thread_local uint32_t t_can_metrics_shard = 0;
+
+static atomic_uint g_next_shard = 0;
+
+// Prometheus 카운터 이름 (can_metric_t 순서)
+static const char *const g_metric_names[CAN_METRIC_COUNT] = {
+    "can_tx_frames_total",
+    "can_tx_errors_total",
+    "can_rx_frames_total",
+    "can_queue_full_drops_total",
+    "can_filter_rejects_total"};
+
+static const char *const g_metric_help[CAN_METRIC_COUNT] = {
+    "Frames put on the bus",
+    "Frames that reached no receive queue",
+    "Frames received",
+    "Frames dropped because the receive queue was full",
+    "Frames rejected by the receive filter"};
+
+static void can_metrics_fill_interface(can_iface_snapshot_t *snap, const can_endpoint_t *endpoint);
+static bool can_metrics_dump_file(const char *path, const can_metrics_snapshot_t *snapshot);
+static bool can_metrics_dump_socket(const char *path, const can_metrics_snapshot_t *snapshot);
+
+uint32_t can_metrics_assign_shard(void)
+{
+    uint32_t shard = atomic_fetch_add_explicit(&g_next_shard, 1, memory_order_relaxed) % CAN_METRICS_SHARDS;
+    t_can_metrics_shard = shard + 1;
+    return shard;
+}
+
+void can_metrics_reset(can_iface_metrics_t *metrics)
+{
+    for (int s = 0; s < CAN_METRICS_SHARDS; s++)
+    {
+        for (int m = 0; m < CAN_METRIC_COUNT; m++)
+        {
+            atomic_store_explicit(&metrics->shards[s].value[m], 0, memory_order_relaxed);
+        }
+    }
+    atomic_store_explicit(&metrics->queue_high_water, 0, memory_order_relaxed);
+}
+
+// 샤드 합산
+uint64_t can_metrics_read(const can_iface_metrics_t *metrics, can_metric_t metric)
+{
+    if (!metrics || metric >= CAN_METRIC_COUNT)
+    {
+        return 0;
+    }
+
+    uint64_t total = 0;
+    for (int s = 0; s < CAN_METRICS_SHARDS; s++)
+    {
+        total += atomic_load_explicit(&metrics->shards[s].value[metric], memory_order_relaxed);
+    }
+    return total;
+}
+
+// 등록된 모든 인터페이스와 ID 별 카운터를 한 번에 읽음
+can_metrics_snapshot_t *can_metrics_snapshot(void)
+{
+    can_epoch_enter();
+    const can_subscribers_t *subscribers = can_registry_subscribers();
+    int cnt = subscribers ? subscribers->cnt : 0;
+
+    can_metrics_snapshot_t *snapshot = malloc(sizeof(can_metrics_snapshot_t) + sizeof(can_iface_snapshot_t) * (size_t)cnt);
+    if (!snapshot)
+    {
+        can_epoch_exit();
+        return NULL;
+    }
+
+    memset(snapshot, 0, sizeof(can_metrics_snapshot_t));
+    snapshot->timestamp_ns = can_monotonic_ns();
+    snapshot->interface_cnt = cnt;
+    snapshot->interfaces = (can_iface_snapshot_t *)(snapshot + 1);
+
+    for (int i = 0; i < cnt; i++)
+    {
+        can_metrics_fill_interface(&snapshot->interfaces[i], subscribers->endpoints[i]);
+    }
+    can_epoch_exit();
+
+    for (int s = 0; s < CAN_METRICS_SHARDS; s++)
+    {
+        for (int slot = 0; slot < CAN_METRICS_ID_SLOTS; slot++)
+        {
+            snapshot->frames_by_id[slot] += atomic_load_explicit(&g_can_id_frames[s][slot], memory_order_relaxed);
+        }
+    }
+
+    return snapshot;
+}
+
+void can_metrics_free_snapshot(can_metrics_snapshot_t *snapshot)
+{
+    free(snapshot);
+}
+
+// 두 스냅샷 사이의 ID 별 초당 메시지 수
+double can_metrics_id_rate(const can_metrics_snapshot_t *prev, const can_metrics_snapshot_t *cur, uint32_t slot)
+{
+    if (!prev || !cur || slot >= CAN_METRICS_ID_SLOTS || cur->timestamp_ns <= prev->timestamp_ns)
+    {
+        return 0.0;
+    }
+
+    double elapsed = (double)(cur->timestamp_ns - prev->timestamp_ns) / 1e9;
+    return (double)(cur->frames_by_id[slot] - prev->frames_by_id[slot]) / elapsed;
+}
+
+// Prometheus text exposition format
+void can_metrics_write_prometheus(FILE *out, const can_metrics_snapshot_t *snapshot)
+{
+    if (!out || !snapshot)
+    {
+        return;
+    }
+
+    for (int m = 0; m < CAN_METRIC_COUNT; m++)
+    {
+        fprintf(out, "# HELP %s %s\n# TYPE %s counter\n", g_metric_names[m], g_metric_help[m], g_metric_names[m]);
+        for (int i = 0; i < snapshot->interface_cnt; i++)
+        {
+            const can_iface_snapshot_t *iface = &snapshot->interfaces[i];
+            fprintf(out, "%s{interface=\"%s\",node=\"0x%03X\"} %llu\n", g_metric_names[m], iface->name, iface->node_id,
+                    (unsigned long long)iface->counters[m]);
+        }
+    }
+
+    fprintf(out, "# HELP can_queue_depth Frames waiting in the receive queue\n# TYPE can_queue_depth gauge\n");
+    for (int i = 0; i < snapshot->interface_cnt; i++)
+    {
+        fprintf(out, "can_queue_depth{interface=\"%s\"} %u\n", snapshot->interfaces[i].name, snapshot->interfaces[i].queue_depth);
+    }
+
+    fprintf(out, "# HELP can_queue_high_water Largest receive queue depth seen\n# TYPE can_queue_high_water gauge\n");
+    for (int i = 0; i < snapshot->interface_cnt; i++)
+    {
+        fprintf(out, "can_queue_high_water{interface=\"%s\"} %u\n", snapshot->interfaces[i].name, snapshot->interfaces[i].queue_high_water);
+    }
+
+    fprintf(out, "# HELP can_rx_latency_seconds Send-to-receive latency (log2 bucket upper bound)\n# TYPE can_rx_latency_seconds summary\n");
+    for (int i = 0; i < snapshot->interface_cnt; i++)
+    {
+        const can_iface_snapshot_t *iface = &snapshot->interfaces[i];
+        if (iface->latency_cnt == 0)
+        {
+            continue;
+        }
+        fprintf(out, "can_rx_latency_seconds{interface=\"%s\",quantile=\"0.5\"} %.9f\n", iface->name, (double)iface->latency_p50_ns / 1e9);
+        fprintf(out, "can_rx_latency_seconds{interface=\"%s\",quantile=\"0.99\"} %.9f\n", iface->name, (double)iface->latency_p99_ns / 1e9);
+        fprintf(out, "can_rx_latency_seconds{interface=\"%s\",quantile=\"0.999\"} %.9f\n", iface->name, (double)iface->latency_p999_ns / 1e9);
+        fprintf(out, "can_rx_latency_seconds_count{interface=\"%s\"} %llu\n", iface->name, (unsigned long long)iface->latency_cnt);
+    }
+
+    // 한 번이라도 송신된 ID 만 출력
+    fprintf(out, "# HELP can_frames_by_id_total Frames put on the bus per CAN ID\n# TYPE can_frames_by_id_total counter\n");
+    for (int slot = 0; slot < CAN_STD_ID_COUNT; slot++)
+    {
+        if (snapshot->frames_by_id[slot] > 0)
+        {
+            fprintf(out, "can_frames_by_id_total{id=\"0x%03X\"} %llu\n", slot, (unsigned long long)snapshot->frames_by_id[slot]);
+        }
+    }
+    if (snapshot->frames_by_id[CAN_METRICS_EXT_SLOT] > 0)
+    {
+        fprintf(out, "can_frames_by_id_total{id=\"extended\"} %llu\n", (unsigned long long)snapshot->frames_by_id[CAN_METRICS_EXT_SLOT]);
+    }
+}
+
+// 파일 경로 또는 "unix:/path" 로 현재 지표를 기록
+bool can_metrics_dump(const char *target)
+{
+    if (!target)
+    {
+        return false;
+    }
+
+    can_metrics_snapshot_t *snapshot = can_metrics_snapshot();
+    if (!snapshot)
+    {
+        return false;
+    }
+
+    bool result;
+    size_t prefix_len = strlen(CAN_METRICS_UNIX_PREFIX);
+    if (strncmp(target, CAN_METRICS_UNIX_PREFIX, prefix_len) == 0)
+    {
+        result = can_metrics_dump_socket(target + prefix_len, snapshot);
+    }
+    else
+    {
+        result = can_metrics_dump_file(target, snapshot);
+    }
+
+    can_metrics_free_snapshot(snapshot);
+    return result;
+}
+
+// ------------- static method -------------
+static void can_metrics_fill_interface(can_iface_snapshot_t *snap, const can_endpoint_t *endpoint)
+{
+    memset(snap, 0, sizeof(can_iface_snapshot_t));
+    snprintf(snap->name, sizeof(snap->name), "%s", endpoint->interface_name);
+    snap->node_id = endpoint->node_id;
+    snap->is_connected = atomic_load(&endpoint->is_connected);
+
+    for (int m = 0; m < CAN_METRIC_COUNT; m++)
+    {
+        snap->counters[m] = can_metrics_read(&endpoint->metrics, (can_metric_t)m);
+    }
+
+    snap->queue_depth = can_ring_size(endpoint->rx_queue);
+    snap->queue_high_water = atomic_load_explicit(&endpoint->metrics.queue_high_water, memory_order_relaxed);
+
+    can_latency_hist_t hist;
+    can_endpoint_latency(endpoint, &hist);
+    snap->latency_cnt = hist.count;
+    snap->latency_p50_ns = can_latency_percentile(&hist, 50.0);
+    snap->latency_p99_ns = can_latency_percentile(&hist, 99.0);
+    snap->latency_p999_ns = can_latency_percentile(&hist, 99.9);
+}
+
+// 임시 파일에 쓴 뒤 교체 (수집기가 쓰다 만 파일을 읽지 않도록)
+static bool can_metrics_dump_file(const char *path, const can_metrics_snapshot_t *snapshot)
+{
+    char tmp_path[512];
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int)sizeof(tmp_path))
+    {
+        return false;
+    }
+
+    FILE *out = fopen(tmp_path, "w");
+    if (!out)
+    {
+        return false;
+    }
+
+    can_metrics_write_prometheus(out, snapshot);
+    if (fclose(out) != 0)
+    {
+        remove(tmp_path);
+        return false;
+    }
+
+#ifdef _WIN32
+    remove(path);
+#endif
+    return rename(tmp_path, path) == 0;
+}
+
+static bool can_metrics_dump_socket(const char *path, const can_metrics_snapshot_t *snapshot)
+{
+#ifdef _WIN32
+    (void)path;
+    (void)snapshot;
+    return false;
+#else
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        return false;
+    }
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    FILE *out = fdopen(fd, "w");
+    if (!out)
+    {
+        close(fd);
+        return false;
+    }
+
+    can_metrics_write_prometheus(out, snapshot);
+    return fclose(out) == 0;
+#endif
+}
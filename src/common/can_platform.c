@@ -0,0 +1,110 @@
+#include "include/can_platform.h"
+#include <time.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+uint64_t can_monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void can_sleep_until_ns(uint64_t deadline_ns)
+{
+#ifdef __linux__
+    struct timespec abs_time;
+    abs_time.tv_sec = (time_t)(deadline_ns / 1000000000ull);
+    abs_time.tv_nsec = (long)(deadline_ns % 1000000000ull);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &abs_time, NULL) == EINTR)
+    {
+    }
+#else
+    uint64_t now = can_monotonic_ns();
+    if (now >= deadline_ns)
+    {
+        return;
+    }
+#ifdef _WIN32
+    Sleep((DWORD)((deadline_ns - now + 999999ull) / 1000000ull));
+#else
+    usleep((useconds_t)((deadline_ns - now + 999ull) / 1000ull));
+#endif
+#endif
+}
+
+bool can_futex_wait(_Atomic uint32_t *addr, uint32_t expected, uint64_t deadline_ns, bool shared)
+{
+    if (deadline_ns != CAN_DEADLINE_NONE && can_monotonic_ns() >= deadline_ns)
+    {
+        return false;
+    }
+
+#ifdef __linux__
+    // FUTEX_WAIT_BITSET 은 CLOCK_MONOTONIC 절대 시각을 타임아웃으로 사용
+    struct timespec abs_time;
+    struct timespec *timeout = NULL;
+    if (deadline_ns != CAN_DEADLINE_NONE)
+    {
+        abs_time.tv_sec = (time_t)(deadline_ns / 1000000000ull);
+        abs_time.tv_nsec = (long)(deadline_ns % 1000000000ull);
+        timeout = &abs_time;
+    }
+
+    int op = FUTEX_WAIT_BITSET | (shared ? 0 : FUTEX_PRIVATE_FLAG);
+    long ret = syscall(SYS_futex, (uint32_t *)addr, op, expected, timeout, NULL, FUTEX_BITSET_MATCH_ANY);
+    if (ret == -1 && errno == ETIMEDOUT)
+    {
+        return false;
+    }
+    return true;
+#elif defined(_WIN32)
+    (void)shared;
+    DWORD wait_ms = INFINITE;
+    if (deadline_ns != CAN_DEADLINE_NONE)
+    {
+        uint64_t now = can_monotonic_ns();
+        wait_ms = now >= deadline_ns ? 0 : (DWORD)((deadline_ns - now + 999999ull) / 1000000ull);
+    }
+    if (!WaitOnAddress((volatile VOID *)addr, &expected, sizeof(expected), wait_ms))
+    {
+        return GetLastError() != ERROR_TIMEOUT;
+    }
+    return true;
+#else
+    // futex 가 없는 플랫폼: 짧은 주기로 값 변경 확인
+    (void)shared;
+    while (atomic_load_explicit(addr, memory_order_acquire) == expected)
+    {
+        if (deadline_ns != CAN_DEADLINE_NONE && can_monotonic_ns() >= deadline_ns)
+        {
+            return false;
+        }
+        usleep(100);
+    }
+    return true;
+#endif
+}
+
+void can_futex_wake_all(_Atomic uint32_t *addr, bool shared)
+{
+#ifdef __linux__
+    int op = FUTEX_WAKE | (shared ? 0 : FUTEX_PRIVATE_FLAG);
+    syscall(SYS_futex, (uint32_t *)addr, op, INT32_MAX, NULL, NULL, 0);
+#elif defined(_WIN32)
+    (void)shared;
+    WakeByAddressAll((PVOID)addr);
+#else
+    (void)addr;
+    (void)shared;
+#endif
+}
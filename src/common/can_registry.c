@@ -0,0 +1,409 @@
+#include "include/can_registry.h"
+#include "include/can_ring.h"
+#include "include/can_epoch.h"
+#include <pthread.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+// 엔드포인트 페이지 (한 번 할당한 페이지는 정리 시까지 유지하므로 포인터가 바뀌지 않음)
+_Atomic(can_endpoint_t *) g_can_registry_pages[CAN_REGISTRY_MAX_PAGES];
+
+// 등록/해제/이름 조회는 lock 으로 보호, 송수신 경로는 페이지와 구독자 목록만 읽음
+static struct
+{
+    pthread_mutex_t lock;
+    uint32_t queue_capacity;
+    uint32_t page_cnt;
+    uint32_t free_head;
+    uint32_t live_cnt;
+
+    uint32_t *name_buckets; // 이름 해시 -> 슬롯 번호 체인
+    uint32_t bucket_cnt;
+
+    _Atomic(can_subscribers_t *) subscribers;                    // 전체 (지표, 보고용)
+    _Atomic(can_subscribers_t *) bus_subscribers[CAN_MAX_BUSES]; // 버스별 (송신 배달용)
+} g_registry = {.lock = PTHREAD_MUTEX_INITIALIZER, .free_head = CAN_REGISTRY_NIL};
+
+static can_endpoint_t *can_registry_slot(uint32_t index);
+static bool can_registry_grow(void);
+static uint32_t can_registry_hash(const char *name);
+static bool can_registry_index_name(can_endpoint_t *endpoint);
+static void can_registry_unindex_name(can_endpoint_t *endpoint);
+static void can_registry_publish(uint32_t bus_id);
+static can_subscribers_t *can_registry_build(bool all, uint32_t bus_id);
+static void can_registry_swap(_Atomic(can_subscribers_t *) *slot, can_subscribers_t *subscribers);
+
+bool can_registry_init(uint32_t queue_capacity)
+{
+    can_registry_cleanup();
+
+    pthread_mutex_lock(&g_registry.lock);
+    g_registry.queue_capacity = queue_capacity;
+    pthread_mutex_unlock(&g_registry.lock);
+
+    return true;
+}
+
+// 모든 엔드포인트와 페이지, 해제를 기다리던 목록과 필터 뱅크 해제 (송수신 중인 스레드가 없어야 함)
+void can_registry_cleanup(void)
+{
+    pthread_mutex_lock(&g_registry.lock);
+
+    for (uint32_t p = 0; p < g_registry.page_cnt; p++)
+    {
+        can_endpoint_t *page = atomic_exchange(&g_can_registry_pages[p], NULL);
+        for (uint32_t i = 0; i < CAN_REGISTRY_PAGE_SIZE; i++)
+        {
+            can_endpoint_t *endpoint = &page[i];
+
+            can_ring_destroy(endpoint->rx_queue);
+            can_ring_destroy(endpoint->tx_queue);
+            free(atomic_load(&endpoint->filter));
+
+#ifdef __linux__
+            int fd = atomic_load(&endpoint->event_fd);
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            fd = atomic_load(&endpoint->sock_fd);
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+#endif
+        }
+        can_aligned_free(page);
+    }
+
+    free(atomic_exchange(&g_registry.subscribers, NULL));
+    for (uint32_t b = 0; b < CAN_MAX_BUSES; b++)
+    {
+        free(atomic_exchange(&g_registry.bus_subscribers[b], NULL));
+    }
+
+    can_epoch_drain();
+
+    free(g_registry.name_buckets);
+    g_registry.name_buckets = NULL;
+    g_registry.bucket_cnt = 0;
+    g_registry.page_cnt = 0;
+    g_registry.free_head = CAN_REGISTRY_NIL;
+    g_registry.live_cnt = 0;
+
+    pthread_mutex_unlock(&g_registry.lock);
+}
+
+// 빈 슬롯을 꺼내 새 핸들을 발급 (빈 슬롯이 없으면 페이지 추가)
+can_endpoint_t *can_registry_open(const char *name, uint32_t node_id, uint32_t bus_id, bool with_tx_queue,
+                                  const struct can_backend *backend)
+{
+    if (bus_id >= CAN_MAX_BUSES)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&g_registry.lock);
+
+    if (g_registry.free_head == CAN_REGISTRY_NIL && !can_registry_grow())
+    {
+        pthread_mutex_unlock(&g_registry.lock);
+        return NULL;
+    }
+
+    can_endpoint_t *endpoint = can_registry_slot(g_registry.free_head);
+
+    // 큐는 슬롯을 처음 사용할 때 할당하고 이후 재사용
+    uint32_t capacity = g_registry.queue_capacity ? g_registry.queue_capacity : CAN_DEFAULT_QUEUE_CAPACITY;
+    if (!endpoint->rx_queue)
+    {
+        endpoint->rx_queue = can_ring_create(capacity);
+    }
+    if (with_tx_queue && !endpoint->tx_queue)
+    {
+        endpoint->tx_queue = can_ring_create(capacity);
+    }
+    if (!endpoint->rx_queue || (with_tx_queue && !endpoint->tx_queue))
+    {
+        pthread_mutex_unlock(&g_registry.lock);
+        printf("[CAN] Failed to allocate queues for '%s'\n", name);
+        return NULL;
+    }
+    g_registry.free_head = endpoint->next_free;
+
+    // 이전 사용자가 남긴 메시지 제거 (해제 직전 송신된 메시지가 남아있을 수 있음)
+    can_frame_t stale[64];
+    while (can_ring_pop_batch(endpoint->rx_queue, stale, 64) > 0)
+    {
+    }
+    while (endpoint->tx_queue && can_ring_pop_batch(endpoint->tx_queue, stale, 64) > 0)
+    {
+    }
+
+    memset(endpoint->interface_name, 0, sizeof(endpoint->interface_name));
+    strncpy(endpoint->interface_name, name, sizeof(endpoint->interface_name) - 1);
+    endpoint->node_id = node_id;
+    endpoint->bus_id = bus_id;
+    endpoint->backend = backend;
+    memset(endpoint->device, 0, sizeof(endpoint->device));
+    atomic_store(&endpoint->is_connected, false);
+    atomic_store(&endpoint->event_pending, false);
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; i++)
+    {
+        atomic_store_explicit(&endpoint->latency_hist[i], 0, memory_order_relaxed);
+    }
+    can_metrics_reset(&endpoint->metrics);
+
+    endpoint->generation = endpoint->generation == UINT16_MAX ? 1 : endpoint->generation + 1;
+
+    if (!can_registry_index_name(endpoint))
+    {
+        endpoint->next_free = g_registry.free_head;
+        g_registry.free_head = endpoint->index;
+        pthread_mutex_unlock(&g_registry.lock);
+        return NULL;
+    }
+
+    g_registry.live_cnt++;
+    atomic_store_explicit(&endpoint->handle, ((can_handle_t)endpoint->generation << CAN_HANDLE_INDEX_BITS) | endpoint->index, memory_order_release);
+    can_registry_publish(bus_id);
+
+    pthread_mutex_unlock(&g_registry.lock);
+    return endpoint;
+}
+
+// 핸들 무효화 후 슬롯 반환 (필터/eventfd 정리는 호출자가 먼저 수행)
+bool can_registry_close(can_handle_t handle)
+{
+    pthread_mutex_lock(&g_registry.lock);
+
+    can_endpoint_t *endpoint = can_registry_get(handle);
+    if (!endpoint)
+    {
+        pthread_mutex_unlock(&g_registry.lock);
+        return false;
+    }
+
+    atomic_store_explicit(&endpoint->handle, CAN_INVALID_HANDLE, memory_order_release);
+    atomic_store(&endpoint->is_connected, false);
+    can_registry_unindex_name(endpoint);
+    g_registry.live_cnt--;
+    can_registry_publish(endpoint->bus_id);
+
+    endpoint->next_free = g_registry.free_head;
+    g_registry.free_head = endpoint->index;
+
+    pthread_mutex_unlock(&g_registry.lock);
+    return true;
+}
+
+// 이름으로 핸들 조회 (같은 이름이 여럿이면 가장 최근에 등록된 것)
+can_handle_t can_registry_find(const char *name)
+{
+    can_handle_t handle = CAN_INVALID_HANDLE;
+
+    pthread_mutex_lock(&g_registry.lock);
+
+    if (g_registry.bucket_cnt > 0)
+    {
+        uint32_t index = g_registry.name_buckets[can_registry_hash(name) & (g_registry.bucket_cnt - 1)];
+        while (index != CAN_REGISTRY_NIL)
+        {
+            can_endpoint_t *endpoint = can_registry_slot(index);
+            if (strncmp(endpoint->interface_name, name, sizeof(endpoint->interface_name) - 1) == 0)
+            {
+                handle = atomic_load(&endpoint->handle);
+                break;
+            }
+            index = endpoint->next_by_name;
+        }
+    }
+
+    pthread_mutex_unlock(&g_registry.lock);
+    return handle;
+}
+
+// 현재 등록된 엔드포인트 목록 (NULL: 등록된 엔드포인트 없음, can_epoch_enter/exit 구간 안에서만 사용)
+const can_subscribers_t *can_registry_subscribers(void)
+{
+    return atomic_load_explicit(&g_registry.subscribers, memory_order_acquire);
+}
+
+const can_subscribers_t *can_registry_bus_subscribers(uint32_t bus_id)
+{
+    if (bus_id >= CAN_MAX_BUSES)
+    {
+        return NULL;
+    }
+
+    return atomic_load_explicit(&g_registry.bus_subscribers[bus_id], memory_order_acquire);
+}
+
+// ------------- static method -------------
+static can_endpoint_t *can_registry_slot(uint32_t index)
+{
+    can_endpoint_t *page = atomic_load_explicit(&g_can_registry_pages[index >> CAN_REGISTRY_PAGE_SHIFT], memory_order_relaxed);
+    return &page[index & (CAN_REGISTRY_PAGE_SIZE - 1)];
+}
+
+// 페이지 하나를 할당하여 빈 슬롯 목록에 추가 (lock 보유)
+static bool can_registry_grow(void)
+{
+    if (g_registry.page_cnt >= CAN_REGISTRY_MAX_PAGES)
+    {
+        printf("[CAN] Maximum interfaces reached\n");
+        return false;
+    }
+
+    can_endpoint_t *page = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(can_endpoint_t) * CAN_REGISTRY_PAGE_SIZE);
+    if (!page)
+    {
+        return false;
+    }
+    memset(page, 0, sizeof(can_endpoint_t) * CAN_REGISTRY_PAGE_SIZE);
+
+    uint32_t base = g_registry.page_cnt << CAN_REGISTRY_PAGE_SHIFT;
+
+    for (uint32_t i = 0; i < CAN_REGISTRY_PAGE_SIZE; i++)
+    {
+        can_endpoint_t *endpoint = &page[i];
+        atomic_init(&endpoint->handle, CAN_INVALID_HANDLE);
+        endpoint->index = base + i;
+        atomic_init(&endpoint->filter, NULL);
+        atomic_init(&endpoint->event_fd, -1);
+        atomic_init(&endpoint->sock_fd, -1);
+        endpoint->next_by_name = CAN_REGISTRY_NIL;
+    }
+
+    // 낮은 번호부터 쓰도록 역순으로 연결
+    for (uint32_t i = CAN_REGISTRY_PAGE_SIZE; i-- > 0;)
+    {
+        page[i].next_free = g_registry.free_head;
+        g_registry.free_head = base + i;
+    }
+
+    atomic_store_explicit(&g_can_registry_pages[g_registry.page_cnt], page, memory_order_release);
+    g_registry.page_cnt++;
+    return true;
+}
+
+// FNV-1a
+static uint32_t can_registry_hash(const char *name)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < 31 && name[i]; i++)
+    {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// 이름 해시에 추가 (등록 수가 버킷 수를 넘으면 버킷을 두 배로, lock 보유)
+static bool can_registry_index_name(can_endpoint_t *endpoint)
+{
+    if (g_registry.live_cnt + 1 > g_registry.bucket_cnt)
+    {
+        uint32_t bucket_cnt = g_registry.bucket_cnt ? g_registry.bucket_cnt * 2 : 16;
+        uint32_t *buckets = malloc(sizeof(uint32_t) * bucket_cnt);
+        if (!buckets)
+        {
+            return false;
+        }
+        for (uint32_t b = 0; b < bucket_cnt; b++)
+        {
+            buckets[b] = CAN_REGISTRY_NIL;
+        }
+
+        // 기존 체인 재배치
+        for (uint32_t b = 0; b < g_registry.bucket_cnt; b++)
+        {
+            uint32_t index = g_registry.name_buckets[b];
+            while (index != CAN_REGISTRY_NIL)
+            {
+                can_endpoint_t *entry = can_registry_slot(index);
+                uint32_t next = entry->next_by_name;
+                uint32_t slot = can_registry_hash(entry->interface_name) & (bucket_cnt - 1);
+                entry->next_by_name = buckets[slot];
+                buckets[slot] = index;
+                index = next;
+            }
+        }
+
+        free(g_registry.name_buckets);
+        g_registry.name_buckets = buckets;
+        g_registry.bucket_cnt = bucket_cnt;
+    }
+
+    uint32_t slot = can_registry_hash(endpoint->interface_name) & (g_registry.bucket_cnt - 1);
+    endpoint->next_by_name = g_registry.name_buckets[slot];
+    g_registry.name_buckets[slot] = endpoint->index;
+    return true;
+}
+
+static void can_registry_unindex_name(can_endpoint_t *endpoint)
+{
+    uint32_t *link = &g_registry.name_buckets[can_registry_hash(endpoint->interface_name) & (g_registry.bucket_cnt - 1)];
+    while (*link != CAN_REGISTRY_NIL)
+    {
+        if (*link == endpoint->index)
+        {
+            *link = endpoint->next_by_name;
+            break;
+        }
+        link = &can_registry_slot(*link)->next_by_name;
+    }
+    endpoint->next_by_name = CAN_REGISTRY_NIL;
+}
+
+// 전체 목록과 bus_id 버스의 목록을 새로 만들어 교체 (lock 보유)
+static void can_registry_publish(uint32_t bus_id)
+{
+    // 할당에 실패하면 이전 목록 유지 (해제된 엔드포인트는 연결 상태 확인으로 걸러짐)
+    can_subscribers_t *all = can_registry_build(true, 0);
+    if (all)
+    {
+        can_registry_swap(&g_registry.subscribers, all);
+    }
+
+    can_subscribers_t *bus = can_registry_build(false, bus_id);
+    if (bus)
+    {
+        can_registry_swap(&g_registry.bus_subscribers[bus_id], bus);
+    }
+}
+
+static can_subscribers_t *can_registry_build(bool all, uint32_t bus_id)
+{
+    can_subscribers_t *subscribers = malloc(sizeof(can_subscribers_t) + sizeof(can_endpoint_t *) * g_registry.live_cnt);
+    if (!subscribers)
+    {
+        return NULL;
+    }
+
+    subscribers->cnt = 0;
+    for (uint32_t p = 0; p < g_registry.page_cnt; p++)
+    {
+        can_endpoint_t *page = atomic_load_explicit(&g_can_registry_pages[p], memory_order_relaxed);
+        for (uint32_t i = 0; i < CAN_REGISTRY_PAGE_SIZE; i++)
+        {
+            if (atomic_load_explicit(&page[i].handle, memory_order_relaxed) != CAN_INVALID_HANDLE &&
+                (all || page[i].bus_id == bus_id))
+            {
+                subscribers->endpoints[subscribers->cnt++] = &page[i];
+            }
+        }
+    }
+
+    return subscribers;
+}
+
+static void can_registry_swap(_Atomic(can_subscribers_t *) *slot, can_subscribers_t *subscribers)
+{
+    can_subscribers_t *old = atomic_exchange_explicit(slot, subscribers, memory_order_acq_rel);
+    can_epoch_retire(old);
+}
@@ -0,0 +1,280 @@
+#include "include/can_ring.h"
+
+static bool can_ring_has_data(can_ring_t *ring);
+
+// capacity 를 2의 거듭제곱으로 올린 링이 차지하는 바이트 수 (캐시 라인 단위)
+size_t can_ring_bytes(uint32_t capacity)
+{
+    size_t size = sizeof(can_ring_t) + (size_t)can_next_pow2(capacity) * sizeof(can_ring_slot_t);
+    return (size + CAN_CACHELINE_SIZE - 1) & ~(size_t)(CAN_CACHELINE_SIZE - 1);
+}
+
+// memory 위에 빈 링 구성 (memory 는 can_ring_bytes(capacity) 이상, 캐시 라인 정렬)
+can_ring_t *can_ring_init(void *memory, uint32_t capacity, bool process_shared)
+{
+    if (!memory || capacity == 0 || capacity > (1u << 31))
+    {
+        return NULL;
+    }
+
+    can_ring_t *ring = memory;
+    memset(ring, 0, can_ring_bytes(capacity));
+    ring->capacity = can_next_pow2(capacity);
+    ring->mask = ring->capacity - 1;
+    ring->process_shared = process_shared;
+
+    // 각 슬롯의 시퀀스를 자신의 위치로 초기화 (= 비어있음)
+    for (uint32_t i = 0; i < ring->capacity; i++)
+    {
+        atomic_init(&ring->slots[i].sequence, i);
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->epoch, 0);
+    atomic_init(&ring->waiters, 0);
+
+    return ring;
+}
+
+can_ring_t *can_ring_create(uint32_t capacity)
+{
+    if (capacity == 0 || capacity > (1u << 31))
+    {
+        return NULL;
+    }
+
+    void *memory = can_aligned_alloc(CAN_CACHELINE_SIZE, can_ring_bytes(capacity));
+    if (!memory)
+    {
+        return NULL;
+    }
+
+    return can_ring_init(memory, capacity, false);
+}
+
+void can_ring_destroy(can_ring_t *ring)
+{
+    can_aligned_free(ring);
+}
+
+bool can_ring_push(can_ring_t *ring, const can_frame_t *frame)
+{
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    while (1)
+    {
+        can_ring_slot_t *slot = &ring->slots[pos & ring->mask];
+        uint64_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int64_t diff = (int64_t)(seq - pos);
+
+        if (diff == 0)
+        {
+            // 슬롯이 비어있음 -> 쓰기 위치 선점
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                slot->frame = *frame;
+                atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+                // 대기 중인 소비자가 있을 때만 시스템 콜
+                atomic_thread_fence(memory_order_seq_cst);
+                if (atomic_load_explicit(&ring->waiters, memory_order_relaxed) > 0)
+                {
+                    can_ring_wake(ring);
+                }
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // 소비자가 아직 이 슬롯을 비우지 않음 -> 큐 가득 참
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+bool can_ring_pop(can_ring_t *ring, can_frame_t *frame)
+{
+    uint64_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    while (1)
+    {
+        can_ring_slot_t *slot = &ring->slots[pos & ring->mask];
+        uint64_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int64_t diff = (int64_t)(seq - (pos + 1));
+
+        if (diff == 0)
+        {
+            // 데이터 있음 -> 읽기 위치 선점
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                *frame = slot->frame;
+                // 다음 바퀴의 생산자를 위해 슬롯 반환
+                atomic_store_explicit(&slot->sequence, pos + ring->mask + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // 큐 비어있음
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        }
+    }
+}
+
+// 연속된 빈 슬롯을 한 번의 CAS 로 예약하여 최대 n 개 적재 (적재된 개수 반환)
+uint32_t can_ring_push_batch(can_ring_t *ring, const can_frame_t *frames, uint32_t n)
+{
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    while (1)
+    {
+        uint32_t free_cnt = 0;
+        while (free_cnt < n && free_cnt <= ring->mask)
+        {
+            uint64_t seq = atomic_load_explicit(&ring->slots[(pos + free_cnt) & ring->mask].sequence, memory_order_acquire);
+            if (seq != pos + free_cnt)
+            {
+                break;
+            }
+            free_cnt++;
+        }
+
+        if (free_cnt == 0)
+        {
+            uint64_t seq = atomic_load_explicit(&ring->slots[pos & ring->mask].sequence, memory_order_acquire);
+            if ((int64_t)(seq - pos) < 0)
+            {
+                return 0;
+            }
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + free_cnt,
+                                                  memory_order_relaxed, memory_order_relaxed))
+        {
+            for (uint32_t i = 0; i < free_cnt; i++)
+            {
+                can_ring_slot_t *slot = &ring->slots[(pos + i) & ring->mask];
+                slot->frame = frames[i];
+                atomic_store_explicit(&slot->sequence, pos + i + 1, memory_order_release);
+            }
+
+            atomic_thread_fence(memory_order_seq_cst);
+            if (atomic_load_explicit(&ring->waiters, memory_order_relaxed) > 0)
+            {
+                can_ring_wake(ring);
+            }
+            return free_cnt;
+        }
+    }
+}
+
+// 연속으로 준비된 슬롯을 한 번의 CAS 로 예약하여 최대 max 개 꺼냄 (꺼낸 개수 반환)
+uint32_t can_ring_pop_batch(can_ring_t *ring, can_frame_t *frames, uint32_t max)
+{
+    if (max == 0)
+    {
+        return 0;
+    }
+
+    uint64_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    while (1)
+    {
+        uint32_t ready_cnt = 0;
+        while (ready_cnt < max && ready_cnt <= ring->mask)
+        {
+            uint64_t seq = atomic_load_explicit(&ring->slots[(pos + ready_cnt) & ring->mask].sequence, memory_order_acquire);
+            if (seq != pos + ready_cnt + 1)
+            {
+                break;
+            }
+            ready_cnt++;
+        }
+
+        if (ready_cnt == 0)
+        {
+            uint64_t seq = atomic_load_explicit(&ring->slots[pos & ring->mask].sequence, memory_order_acquire);
+            if ((int64_t)(seq - (pos + 1)) < 0)
+            {
+                return 0;
+            }
+            pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + ready_cnt,
+                                                  memory_order_relaxed, memory_order_relaxed))
+        {
+            for (uint32_t i = 0; i < ready_cnt; i++)
+            {
+                can_ring_slot_t *slot = &ring->slots[(pos + i) & ring->mask];
+                frames[i] = slot->frame;
+                atomic_store_explicit(&slot->sequence, pos + i + ring->mask + 1, memory_order_release);
+            }
+            return ready_cnt;
+        }
+    }
+}
+
+// 현재 메시지 수 (동시 접근 중에는 근사값)
+uint32_t can_ring_size(const can_ring_t *ring)
+{
+    uint64_t tail = atomic_load_explicit(&((can_ring_t *)ring)->tail, memory_order_acquire);
+    uint64_t head = atomic_load_explicit(&((can_ring_t *)ring)->head, memory_order_acquire);
+
+    if (head <= tail)
+    {
+        return 0;
+    }
+    uint64_t size = head - tail;
+    return size > ring->capacity ? ring->capacity : (uint32_t)size;
+}
+
+// 메시지가 들어오거나 deadline_ns 가 지날 때까지 대기 (타임아웃 시 false)
+bool can_ring_wait(can_ring_t *ring, uint64_t deadline_ns)
+{
+    atomic_fetch_add_explicit(&ring->waiters, 1, memory_order_seq_cst);
+    uint32_t epoch = atomic_load_explicit(&ring->epoch, memory_order_seq_cst);
+
+    // 대기자 등록 후 다시 확인하여 깨우기 누락 방지
+    bool woken = true;
+    if (!can_ring_has_data(ring))
+    {
+        woken = can_futex_wait(&ring->epoch, epoch, deadline_ns, ring->process_shared);
+    }
+
+    atomic_fetch_sub_explicit(&ring->waiters, 1, memory_order_relaxed);
+    return woken;
+}
+
+// 대기 중인 소비자 모두 깨우기
+void can_ring_wake(can_ring_t *ring)
+{
+    atomic_fetch_add_explicit(&ring->epoch, 1, memory_order_release);
+    can_futex_wake_all(&ring->epoch, ring->process_shared);
+}
+
+// ------------- static method -------------
+static bool can_ring_has_data(can_ring_t *ring)
+{
+    uint64_t pos = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint64_t seq = atomic_load_explicit(&ring->slots[pos & ring->mask].sequence, memory_order_acquire);
+    return seq == pos + 1;
+}
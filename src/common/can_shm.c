@@ -0,0 +1,693 @@
+#ifdef __linux__
+#define _GNU_SOURCE // memfd_create
+#endif
+
+#include "include/can_shm.h"
+#include "include/can_backend.h"
+#include "include/can_ring.h"
+#include "include/can_epoch.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define CAN_SHM_HEADER_SIZE ((sizeof(can_shm_header_t) + CAN_CACHELINE_SIZE - 1) & ~(size_t)(CAN_CACHELINE_SIZE - 1))
+
+// 연결 중인 인터페이스의 매핑
+typedef struct
+{
+    can_shm_header_t *header;
+    size_t size;
+    uint32_t slot;
+} can_shm_attach_t;
+
+static can_error_t can_shm_open(can_endpoint_t *endpoint);
+static void can_shm_close(can_endpoint_t *endpoint);
+static int can_shm_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+static int can_shm_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms);
+static int can_shm_event_fd(can_endpoint_t *endpoint);
+static void can_shm_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank);
+
+// 프로세스 간 공유 메모리 버스 (슬롯마다 수신 링, 송신측이 필터를 적용하여 직접 적재)
+const can_backend_t g_can_shm_backend = {
+    .name = "shm",
+    .open = can_shm_open,
+    .close = can_shm_close,
+    .send = can_shm_send,
+    .receive = can_shm_receive,
+    .event_fd = can_shm_event_fd,
+    .set_filter = can_shm_set_filter};
+
+#ifndef _WIN32
+static size_t can_shm_layout(uint32_t ring_capacity, uint64_t *slot_stride, uint64_t *ring_offset);
+static void can_shm_format(void *base, uint32_t ring_capacity);
+static can_shm_header_t *can_shm_map(const char *device, uint32_t ring_capacity, size_t *size);
+static bool can_shm_wait_ready(int fd, size_t *size);
+static void can_shm_reap(can_shm_header_t *header);
+static bool can_shm_reap_slot(can_shm_header_t *header, uint32_t index);
+static bool can_shm_owner_alive(const can_shm_slot_t *slot);
+static bool can_shm_claim(can_shm_header_t *header, can_endpoint_t *endpoint, uint32_t *slot_index);
+static void can_shm_wait_senders(can_shm_header_t *header, uint32_t index);
+static void can_shm_write_filter(can_shm_slot_t *slot, const can_filter_bank_t *bank);
+static bool can_shm_accept(can_shm_slot_t *slot, const can_frame_t *frames, int n, uint64_t *accept);
+static uint64_t can_shm_deliver(can_shm_slot_t *slot, can_ring_t *ring, const can_frame_t *frames, uint64_t accept);
+
+static inline can_shm_slot_t *can_shm_slot(const can_shm_header_t *header, uint32_t index)
+{
+    return (can_shm_slot_t *)((char *)header + CAN_SHM_HEADER_SIZE + header->slot_stride * index);
+}
+
+static inline can_ring_t *can_shm_ring(const can_shm_header_t *header, uint32_t index)
+{
+    return (can_ring_t *)((char *)can_shm_slot(header, index) + header->ring_offset);
+}
+#endif
+
+// 초기화된 익명 공유 메모리 영역 생성 (fork/exec 한 자식 프로세스는 "fd:<n>" 으로 연결)
+int can_shm_create_memfd(const char *name, uint32_t ring_capacity)
+{
+#ifdef __linux__
+    if (!name || ring_capacity == 0 || ring_capacity > (1u << 31))
+    {
+        return -1;
+    }
+
+    uint64_t slot_stride, ring_offset;
+    size_t size = can_shm_layout(ring_capacity, &slot_stride, &ring_offset);
+
+    int fd = memfd_create(name, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+    {
+        close(fd);
+        return -1;
+    }
+
+    can_shm_format(base, ring_capacity);
+    munmap(base, size);
+    return fd;
+#else
+    (void)name;
+    (void)ring_capacity;
+    return -1;
+#endif
+}
+
+// ------------- static method -------------
+#ifndef _WIN32
+// 영역을 매핑하고 빈 슬롯을 차지 (죽은 프로세스가 남긴 슬롯은 먼저 회수)
+static can_error_t can_shm_open(can_endpoint_t *endpoint)
+{
+    if (endpoint->backend_ctx)
+    {
+        return CAN_SUCCESS;
+    }
+
+    // 영역을 새로 만들 때는 관리자의 수신 큐 용량을 사용
+    size_t size = 0;
+    uint32_t ring_capacity = endpoint->rx_queue ? endpoint->rx_queue->capacity : CAN_DEFAULT_QUEUE_CAPACITY;
+    can_shm_header_t *header = can_shm_map(endpoint->device, ring_capacity, &size);
+    if (!header)
+    {
+        printf("[CAN] Failed to attach shared memory bus '%s'\n", endpoint->device);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    can_shm_reap(header);
+
+    can_shm_attach_t *attach = malloc(sizeof(can_shm_attach_t));
+    if (!attach || !can_shm_claim(header, endpoint, &attach->slot))
+    {
+        printf("[CAN] No free slot on shared memory bus '%s'\n", endpoint->device);
+        free(attach);
+        munmap(header, size);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    attach->header = header;
+    attach->size = size;
+    endpoint->backend_ctx = attach;
+    return CAN_SUCCESS;
+}
+
+static void can_shm_close(can_endpoint_t *endpoint)
+{
+    can_shm_attach_t *attach = endpoint->backend_ctx;
+    if (!attach)
+    {
+        return;
+    }
+
+    // 송신 대상에서 먼저 빼고 소유권을 놓음 (적재 중인 송신측은 다음에 차지하는 쪽이 기다림)
+    can_shm_slot_t *slot = can_shm_slot(attach->header, attach->slot);
+    atomic_store(&slot->state, CAN_SHM_SLOT_FREE);
+    atomic_store_explicit(&slot->owner_pid, 0, memory_order_release);
+
+    munmap(attach->header, attach->size);
+    endpoint->backend_ctx = NULL;
+    free(attach);
+}
+
+// 다른 슬롯의 수신 링에 직접 적재 (받을 슬롯이 없거나 하나 이상에 적재되면 송신 성공)
+// 앞에서부터 연속으로 성공한 메시지 수를 반환하고 실패한 메시지가 있으면 그 묶음에서 멈춤
+// (슬롯마다 따로 적재하므로 같은 묶음의 뒤쪽 메시지는 일부 슬롯에 들어갔을 수 있음)
+static int can_shm_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    can_shm_attach_t *attach = endpoint->backend_ctx;
+    if (!attach)
+    {
+        return CAN_ERROR_NOT_CONNECTED;
+    }
+
+    can_shm_header_t *header = attach->header;
+    can_frame_t chunk[64];
+    int sent = 0;
+
+    for (int base = 0; base < n; base += 64)
+    {
+        int chunk_len = (n - base) < 64 ? (n - base) : 64;
+        memcpy(chunk, &frames[base], sizeof(can_frame_t) * (size_t)chunk_len);
+        for (int k = 0; k < chunk_len; k++)
+        {
+            chunk[k].timestamp_ns = timestamp_ns;
+        }
+        uint64_t all = chunk_len == 64 ? ~0ull : ((1ull << chunk_len) - 1);
+        uint64_t matched = 0;
+        uint64_t delivered = 0;
+
+        for (uint32_t i = 0; i < header->slot_cnt; i++)
+        {
+            can_shm_slot_t *slot = can_shm_slot(header, i);
+            if (i == attach->slot || atomic_load_explicit(&slot->state, memory_order_acquire) != CAN_SHM_SLOT_ACTIVE)
+            {
+                continue;
+            }
+
+            // 적재 중 표시 후 다시 확인 (표시 전에 비활성화된 슬롯은 차지하는 쪽이 이 송신을 기다리지 않으므로 건너뜀)
+            atomic_fetch_add(&slot->senders[attach->slot], 1);
+            if (atomic_load(&slot->state) != CAN_SHM_SLOT_ACTIVE)
+            {
+                atomic_fetch_sub(&slot->senders[attach->slot], 1);
+                continue;
+            }
+
+            uint64_t accept = 0;
+            bool accepted = can_shm_accept(slot, chunk, chunk_len, &accept);
+            uint64_t pushed = accepted ? can_shm_deliver(slot, can_shm_ring(header, i), chunk, accept) : 0;
+            atomic_fetch_sub(&slot->senders[attach->slot], 1);
+
+            // 필터 갱신 도중 종료한 프로세스의 슬롯은 건너뛰고 회수
+            if (!accepted)
+            {
+                can_shm_reap_slot(header, i);
+                continue;
+            }
+
+            matched |= accept;
+            delivered |= pushed;
+
+            // 수신 링이 가득 참: 소유 프로세스가 종료해서 비우지 않는 것이면 회수
+            if (pushed != accept && !can_shm_owner_alive(slot))
+            {
+                can_shm_reap_slot(header, i);
+            }
+        }
+
+        uint64_t sent_mask = (~matched | delivered) & all;
+        int prefix = sent_mask == ~0ull ? 64 : __builtin_ctzll(~sent_mask);
+
+        for (int k = 0; k < prefix; k++)
+        {
+            can_metrics_count_id(chunk[k].id, chunk[k].is_extended);
+        }
+
+        sent += prefix;
+        if (prefix < chunk_len)
+        {
+            break;
+        }
+    }
+
+    return sent;
+}
+
+// 자신의 슬롯 링에서 꺼냄 (프로세스 간 futex 로 대기, 연결 해제는 주기적으로 확인)
+static int can_shm_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms)
+{
+    can_shm_attach_t *attach = endpoint->backend_ctx;
+    if (!attach)
+    {
+        return CAN_ERROR_NOT_CONNECTED;
+    }
+
+    can_ring_t *ring = can_shm_ring(attach->header, attach->slot);
+    uint64_t deadline_ns = CAN_DEADLINE_NONE;
+    if (timeout_ms > 0)
+    {
+        deadline_ns = can_monotonic_ns() + (uint64_t)timeout_ms * 1000000ull;
+    }
+
+    while (1)
+    {
+        uint32_t received = can_ring_pop_batch(ring, frames, (uint32_t)max);
+        if (received > 0)
+        {
+            return (int)received;
+        }
+
+        if (timeout_ms == 0)
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        uint64_t now = can_monotonic_ns();
+        if (now >= deadline_ns)
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        uint64_t slice_ns = now + (uint64_t)CAN_SHM_POLL_SLICE_MS * 1000000ull;
+        can_ring_wait(ring, slice_ns < deadline_ns ? slice_ns : deadline_ns);
+
+        if (!atomic_load(&endpoint->is_connected))
+        {
+            return CAN_ERROR_NOT_CONNECTED;
+        }
+    }
+}
+
+static int can_shm_event_fd(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+    return -1; // futex 로만 알림
+}
+
+// seqlock 으로 슬롯 필터 갱신 (송신측은 홀수이거나 값이 바뀌면 다시 읽음)
+static void can_shm_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank)
+{
+    can_shm_attach_t *attach = endpoint->backend_ctx;
+    if (!attach)
+    {
+        return;
+    }
+
+    can_shm_write_filter(can_shm_slot(attach->header, attach->slot), bank);
+}
+
+// 헤더, 슬롯 헤더, 수신 링을 캐시 라인 단위로 배치한 영역 크기
+static size_t can_shm_layout(uint32_t ring_capacity, uint64_t *slot_stride, uint64_t *ring_offset)
+{
+    *ring_offset = (sizeof(can_shm_slot_t) + CAN_CACHELINE_SIZE - 1) & ~(uint64_t)(CAN_CACHELINE_SIZE - 1);
+    *slot_stride = *ring_offset + can_ring_bytes(ring_capacity);
+    return CAN_SHM_HEADER_SIZE + (size_t)(*slot_stride * CAN_SHM_SLOTS);
+}
+
+static void can_shm_format(void *base, uint32_t ring_capacity)
+{
+    can_shm_header_t *header = base;
+    header->magic = CAN_SHM_MAGIC;
+    header->version = CAN_SHM_VERSION;
+    header->slot_cnt = CAN_SHM_SLOTS;
+    header->ring_capacity = can_next_pow2(ring_capacity);
+    can_shm_layout(ring_capacity, &header->slot_stride, &header->ring_offset);
+
+    for (uint32_t i = 0; i < header->slot_cnt; i++)
+    {
+        can_shm_slot_t *slot = can_shm_slot(header, i);
+        memset(slot, 0, sizeof(can_shm_slot_t));
+        can_ring_init(can_shm_ring(header, i), header->ring_capacity, true);
+    }
+
+    atomic_store_explicit(&header->ready, 1, memory_order_release);
+}
+
+// "fd:<n>" 이면 상속받은 memfd, 아니면 shm_open (처음 연 프로세스가 ring_capacity 로 초기화)
+static can_shm_header_t *can_shm_map(const char *device, uint32_t ring_capacity, size_t *size)
+{
+    size_t prefix_len = strlen(CAN_SHM_FD_PREFIX);
+    bool inherited = strncmp(device, CAN_SHM_FD_PREFIX, prefix_len) == 0;
+    int fd;
+
+    if (inherited)
+    {
+        fd = atoi(device + prefix_len);
+    }
+    else
+    {
+        fd = shm_open(device, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+        {
+            uint64_t slot_stride, ring_offset;
+            *size = can_shm_layout(ring_capacity, &slot_stride, &ring_offset);
+            void *base = MAP_FAILED;
+            if (ftruncate(fd, (off_t)*size) == 0)
+            {
+                base = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+
+            if (base == MAP_FAILED)
+            {
+                shm_unlink(device);
+                return NULL;
+            }
+
+            can_shm_format(base, ring_capacity);
+            return base;
+        }
+
+        if (errno != EEXIST)
+        {
+            return NULL;
+        }
+        fd = shm_open(device, O_RDWR, 0600);
+    }
+
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    can_shm_header_t *header = NULL;
+    if (can_shm_wait_ready(fd, size))
+    {
+        void *base = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        header = base == MAP_FAILED ? NULL : base;
+    }
+
+    if (!inherited)
+    {
+        close(fd);
+    }
+
+    // 다른 프로세스가 초기화를 마쳤는지, 같은 배치인지 확인
+    uint64_t deadline_ns = can_monotonic_ns() + (uint64_t)CAN_SHM_ATTACH_TIMEOUT_MS * 1000000ull;
+    while (header && !atomic_load_explicit(&header->ready, memory_order_acquire))
+    {
+        if (can_monotonic_ns() >= deadline_ns)
+        {
+            munmap(header, *size);
+            return NULL;
+        }
+        can_sleep_until_ns(can_monotonic_ns() + 1000000ull);
+    }
+
+    if (header && (header->magic != CAN_SHM_MAGIC || header->version != CAN_SHM_VERSION || header->slot_cnt > CAN_SHM_SLOTS ||
+                   CAN_SHM_HEADER_SIZE + header->slot_stride * header->slot_cnt > *size))
+    {
+        munmap(header, *size);
+        return NULL;
+    }
+
+    return header;
+}
+
+// 생성한 프로세스가 ftruncate 할 때까지 대기
+static bool can_shm_wait_ready(int fd, size_t *size)
+{
+    uint64_t deadline_ns = can_monotonic_ns() + (uint64_t)CAN_SHM_ATTACH_TIMEOUT_MS * 1000000ull;
+    struct stat st;
+
+    while (fstat(fd, &st) == 0)
+    {
+        if (st.st_size >= (off_t)CAN_SHM_HEADER_SIZE)
+        {
+            *size = (size_t)st.st_size;
+            return true;
+        }
+
+        if (can_monotonic_ns() >= deadline_ns)
+        {
+            break;
+        }
+        can_sleep_until_ns(can_monotonic_ns() + 1000000ull);
+    }
+
+    return false;
+}
+
+// 소유 프로세스가 없어진 슬롯을 빈 슬롯으로 되돌림
+static void can_shm_reap(can_shm_header_t *header)
+{
+    for (uint32_t i = 0; i < header->slot_cnt; i++)
+    {
+        can_shm_reap_slot(header, i);
+    }
+}
+
+// 소유 프로세스가 종료한 슬롯이면 빈 슬롯으로 되돌림 (회수했으면 true)
+// 죽은 pid 를 자신의 pid 로 바꾼 프로세스 하나만 회수하며, 회수 도중 종료해도 다시 죽은 pid 가 남아 다음에 회수됨
+static bool can_shm_reap_slot(can_shm_header_t *header, uint32_t index)
+{
+    can_shm_slot_t *slot = can_shm_slot(header, index);
+    int32_t pid = atomic_load(&slot->owner_pid);
+
+    if (pid == 0 || can_shm_owner_alive(slot))
+    {
+        return false;
+    }
+
+    if (!atomic_compare_exchange_strong(&slot->owner_pid, &pid, (int32_t)getpid()))
+    {
+        return false;
+    }
+
+    atomic_store(&slot->state, CAN_SHM_SLOT_CLAIMED);
+
+    // 종료한 프로세스가 이 슬롯으로 다른 슬롯에 적재하던 중이었으면 그 표시는 줄어들지 않으므로 지움
+    // (pid 를 가져왔으므로 지금 이 슬롯 번호로 송신하는 프로세스는 없음)
+    for (uint32_t i = 0; i < header->slot_cnt; i++)
+    {
+        atomic_store(&can_shm_slot(header, i)->senders[index], 0);
+    }
+
+    atomic_store(&slot->state, CAN_SHM_SLOT_FREE);
+    atomic_store_explicit(&slot->owner_pid, 0, memory_order_release);
+
+    printf("[CAN] Reclaimed shared memory slot %u (pid %d exited)\n", index, pid);
+    return true;
+}
+
+// 소유 프로세스가 살아있는지 (빈 슬롯이면 false, 확인할 수 없으면 살아있는 것으로 봄)
+static bool can_shm_owner_alive(const can_shm_slot_t *slot)
+{
+    int32_t pid = atomic_load_explicit(&slot->owner_pid, memory_order_relaxed);
+    return pid > 0 && (kill(pid, 0) == 0 || errno != ESRCH);
+}
+
+// 빈 슬롯을 차지하고 수신 링과 필터를 초기화한 뒤 활성화
+// pid 기록이 곧 차지이므로 차지 직후 종료해도 죽은 pid 가 남아 회수됨
+static bool can_shm_claim(can_shm_header_t *header, can_endpoint_t *endpoint, uint32_t *slot_index)
+{
+    for (uint32_t i = 0; i < header->slot_cnt; i++)
+    {
+        can_shm_slot_t *slot = can_shm_slot(header, i);
+        int32_t expected = 0;
+        if (!atomic_compare_exchange_strong(&slot->owner_pid, &expected, (int32_t)getpid()))
+        {
+            continue;
+        }
+
+        atomic_store(&slot->state, CAN_SHM_SLOT_CLAIMED);
+
+        // 이전 소유자가 활성 상태일 때 적재를 시작한 송신측이 끝난 뒤에 링을 다시 구성
+        can_shm_wait_senders(header, i);
+
+        slot->node_id = endpoint->node_id;
+        snprintf(slot->name, sizeof(slot->name), "%s", endpoint->interface_name);
+        atomic_store_explicit(&slot->queue_full_drops, 0, memory_order_relaxed);
+
+        // 이전 소유자가 적재 도중 종료했을 수 있으므로 링을 새로 구성
+        can_ring_init(can_shm_ring(header, i), header->ring_capacity, true);
+
+        // 필터 갱신 도중 종료했으면 filter_seq 가 홀수로 남아있으므로 다시 짝수로 맞추며 기록
+        can_epoch_enter();
+        can_shm_write_filter(slot, atomic_load_explicit(&endpoint->filter, memory_order_acquire));
+        can_epoch_exit();
+
+        atomic_store_explicit(&slot->state, CAN_SHM_SLOT_ACTIVE, memory_order_release);
+        *slot_index = i;
+        return true;
+    }
+
+    return false;
+}
+
+// 슬롯 index 의 수신 링에 적재 중인 송신측이 모두 빠져나갈 때까지 대기
+// 송신 프로세스가 적재 도중 종료했으면 그 슬롯을 회수하며 표시를 지움
+static void can_shm_wait_senders(can_shm_header_t *header, uint32_t index)
+{
+    can_shm_slot_t *slot = can_shm_slot(header, index);
+
+    for (uint32_t j = 0; j < header->slot_cnt; j++)
+    {
+        uint32_t spins = 0;
+        while (atomic_load(&slot->senders[j]) != 0)
+        {
+            if (++spins % CAN_SHM_DRAIN_SPIN == 0)
+            {
+                can_shm_reap_slot(header, j);
+                sched_yield();
+            }
+        }
+    }
+}
+
+// seqlock 으로 슬롯 필터 기록 (홀수로 시작하여 다음 짝수로 끝냄, 홀수로 남은 값도 짝수로 돌아옴)
+static void can_shm_write_filter(can_shm_slot_t *slot, const can_filter_bank_t *bank)
+{
+    uint32_t seq = atomic_load_explicit(&slot->filter_seq, memory_order_relaxed) | 1;
+
+    atomic_store_explicit(&slot->filter_seq, seq, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->filter_enabled = bank != NULL;
+    if (bank)
+    {
+        memcpy(&slot->filter, bank, sizeof(can_filter_bank_t));
+    }
+
+    atomic_store_explicit(&slot->filter_seq, seq + 1, memory_order_release);
+}
+
+// 슬롯 필터를 통과한 메시지의 비트마스크 (읽는 중 갱신되면 다시 계산)
+// 갱신 중 표시가 오래 남아있고 소유 프로세스가 종료했으면 false
+static bool can_shm_accept(can_shm_slot_t *slot, const can_frame_t *frames, int n, uint64_t *accept)
+{
+    uint64_t all = n == 64 ? ~0ull : ((1ull << n) - 1);
+    uint32_t spins = 0;
+
+    while (1)
+    {
+        uint32_t seq = atomic_load_explicit(&slot->filter_seq, memory_order_acquire);
+        if (seq & 1)
+        {
+            if (++spins % CAN_SHM_FILTER_SPIN == 0)
+            {
+                if (atomic_load_explicit(&slot->state, memory_order_acquire) != CAN_SHM_SLOT_ACTIVE || !can_shm_owner_alive(slot))
+                {
+                    return false;
+                }
+                sched_yield();
+            }
+            continue;
+        }
+
+        uint64_t mask = all;
+        if (slot->filter_enabled)
+        {
+            mask = 0;
+            for (int k = 0; k < n; k++)
+            {
+                if (can_filter_bank_accept(&slot->filter, frames[k].id, frames[k].is_extended))
+                {
+                    mask |= 1ull << k;
+                }
+            }
+        }
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->filter_seq, memory_order_relaxed) == seq)
+        {
+            *accept = mask;
+            return true;
+        }
+    }
+}
+
+// accept 비트가 연속된 구간마다 한 번에 적재 (배달된 메시지의 비트마스크 반환)
+static uint64_t can_shm_deliver(can_shm_slot_t *slot, can_ring_t *ring, const can_frame_t *frames, uint64_t accept)
+{
+    uint64_t delivered = 0;
+
+    while (accept)
+    {
+        int start = __builtin_ctzll(accept);
+        uint64_t rest = accept >> start;
+        int len = (rest == ~0ull) ? 64 : __builtin_ctzll(~rest);
+        uint64_t run_mask = (len == 64) ? ~0ull : (((1ull << len) - 1) << start);
+
+        uint32_t pushed = 0;
+        while (pushed < (uint32_t)len)
+        {
+            uint32_t k = can_ring_push_batch(ring, &frames[start + pushed], (uint32_t)len - pushed);
+            if (k == 0)
+            {
+                break;
+            }
+            pushed += k;
+        }
+
+        if (pushed > 0)
+        {
+            delivered |= (pushed == 64) ? ~0ull : (((1ull << pushed) - 1) << start);
+        }
+
+        atomic_fetch_add_explicit(&slot->queue_full_drops, (uint32_t)len - pushed, memory_order_relaxed);
+        accept &= ~run_mask;
+    }
+
+    return delivered;
+}
+#else
+static can_error_t can_shm_open(can_endpoint_t *endpoint)
+{
+    printf("[CAN] Shared memory bus is not supported on this platform ('%s')\n", endpoint->device);
+    return CAN_ERROR_INIT_FAILED;
+}
+
+static void can_shm_close(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+}
+
+static int can_shm_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    (void)endpoint;
+    (void)frames;
+    (void)n;
+    (void)timestamp_ns;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+static int can_shm_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms)
+{
+    (void)endpoint;
+    (void)frames;
+    (void)max;
+    (void)timeout_ms;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+static int can_shm_event_fd(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+    return -1;
+}
+
+static void can_shm_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank)
+{
+    (void)endpoint;
+    (void)bank;
+}
+#endif
@@ -0,0 +1,268 @@
+// 공유 메모리 버스 다중 프로세스 점검 (연결, 강제 종료, 재연결 시 슬롯 회수와 수신 링 재구성)
+// 빌드: gcc -O2 -std=gnu11 -pthread -o can_shm_smoke $(ls src/common/*.c | grep -v _smoke.c) src/common/can_shm_smoke.c -lm
+// 실행: ./can_shm_smoke
+#include "include/can_interface.h"
+#include "include/can_shm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#define SMOKE_RING_CAPACITY 256
+#define SMOKE_FRAMES 1000
+#define SMOKE_TIMEOUT_MS 2000
+#define SMOKE_DEADLINE_S 20 // 재연결이 멈추면 이 시간 뒤 실패로 종료
+
+// 자식 프로세스 동작
+typedef enum
+{
+    SMOKE_CHILD_FLOOD = 0, // 죽을 때까지 계속 송신 (적재 도중 강제 종료)
+    SMOKE_CHILD_EXIT,      // 연결만 하고 닫지 않은 채 종료
+    SMOKE_CHILD_SEND       // SMOKE_FRAMES 개 송신 후 정상 종료
+} smoke_child_t;
+
+static int g_failures = 0;
+static char g_device[32];
+
+static void smoke_check(bool ok, const char *what);
+static pid_t smoke_spawn(smoke_child_t mode, int *go_fd);
+static void smoke_child(smoke_child_t mode, int go_fd);
+static void smoke_release(int go_fd);
+static can_shm_slot_t *smoke_slot(can_shm_header_t *header, uint32_t index);
+static int smoke_find_slot(can_shm_header_t *header, int32_t pid);
+static int smoke_receive(can_interface_t *rx, int want);
+static bool smoke_connect_rx(can_interface_t *rx);
+
+int main(void)
+{
+    int memfd = can_shm_create_memfd("can_shm_smoke", SMOKE_RING_CAPACITY);
+    if (memfd < 0)
+    {
+        printf("[SMOKE] Failed to create shared memory bus\n");
+        return 1;
+    }
+    snprintf(g_device, sizeof(g_device), CAN_SHM_FD_PREFIX "%d", memfd);
+
+    struct stat st;
+    fstat(memfd, &st);
+    can_shm_header_t *header = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (header == MAP_FAILED)
+    {
+        printf("[SMOKE] Failed to map shared memory bus\n");
+        return 1;
+    }
+
+    // 관리자 스레드를 만들기 전에 자식을 모두 띄워둠 (각자 신호를 받으면 시작)
+    int flood_go, exit_go, send_go;
+    pid_t flood = smoke_spawn(SMOKE_CHILD_FLOOD, &flood_go);
+    pid_t exiter = smoke_spawn(SMOKE_CHILD_EXIT, &exit_go);
+    pid_t sender = smoke_spawn(SMOKE_CHILD_SEND, &send_go);
+    alarm(SMOKE_DEADLINE_S);
+
+    can_init_manager(false);
+
+    can_interface_t rx;
+    smoke_check(smoke_connect_rx(&rx), "receiver attached");
+    int rx_slot = smoke_find_slot(header, getpid());
+
+    // 1. 계속 송신하는 프로세스를 적재 도중 강제 종료한 뒤 같은 슬롯으로 재연결
+    smoke_release(flood_go);
+    smoke_check(smoke_receive(&rx, SMOKE_RING_CAPACITY) > 0, "frames from flooding sender");
+    int flood_slot = smoke_find_slot(header, flood);
+    kill(flood, SIGKILL);
+    waitpid(flood, NULL, 0);
+
+    // 죽은 송신측이 적재 중 표시를 남긴 경우를 확정적으로 만듦 (재연결이 기다리지 않고 회수해야 함)
+    if (rx_slot >= 0 && flood_slot >= 0)
+    {
+        atomic_fetch_add(&smoke_slot(header, (uint32_t)rx_slot)->senders[flood_slot], 1);
+    }
+
+    can_destroy_interface(&rx);
+    smoke_check(smoke_connect_rx(&rx), "reattach after killing a sender mid-flood");
+    smoke_check(smoke_find_slot(header, getpid()) == rx_slot, "receiver reuses its slot");
+    smoke_check(flood_slot >= 0 && atomic_load(&smoke_slot(header, (uint32_t)flood_slot)->owner_pid) == 0,
+                "killed sender's slot is reclaimed");
+    smoke_check(rx_slot >= 0 && flood_slot >= 0 && atomic_load(&smoke_slot(header, (uint32_t)rx_slot)->senders[flood_slot]) == 0,
+                "stale in-flight count is cleared");
+
+    // 2. 연결한 채 종료한 프로세스의 슬롯은 다음 연결에서 회수
+    smoke_release(exit_go);
+    waitpid(exiter, NULL, 0);
+    int exit_slot = smoke_find_slot(header, exiter);
+    smoke_check(exit_slot >= 0, "exited process still holds its slot");
+
+    // 3. 차지 직후(pid 기록, 활성화 전) 종료한 슬롯 흉내: 죽은 pid 로 CLAIMED 상태인 슬롯
+    int claimed_slot = -1;
+    for (uint32_t i = 0; i < header->slot_cnt && claimed_slot < 0; i++)
+    {
+        can_shm_slot_t *slot = smoke_slot(header, i);
+        int32_t expected = 0;
+        if (atomic_compare_exchange_strong(&slot->owner_pid, &expected, (int32_t)flood))
+        {
+            atomic_store(&slot->state, CAN_SHM_SLOT_CLAIMED);
+            claimed_slot = (int)i;
+        }
+    }
+
+    can_interface_t probe;
+    can_interface_config_t config = {.backend = CAN_BACKEND_SHM, .device = g_device};
+    can_create_interface_ex(&probe, "smoke_probe", 0x30, &config);
+    smoke_check(can_connect(&probe) == CAN_SUCCESS, "attach after dead owners");
+    smoke_check(exit_slot >= 0 && atomic_load(&smoke_slot(header, (uint32_t)exit_slot)->owner_pid) != exiter,
+                "exited process slot is reclaimed");
+    smoke_check(claimed_slot >= 0 && atomic_load(&smoke_slot(header, (uint32_t)claimed_slot)->owner_pid) != flood,
+                "claimed slot with dead pid is reclaimed");
+    can_destroy_interface(&probe);
+
+    // 4. 재구성한 링으로 정상 송수신
+    smoke_release(send_go);
+    int received = smoke_receive(&rx, SMOKE_FRAMES);
+    int status = 0;
+    waitpid(sender, &status, 0);
+    smoke_check(received == SMOKE_FRAMES && WIFEXITED(status) && WEXITSTATUS(status) == 0, "all frames after reattach");
+
+    can_destroy_interface(&rx);
+    can_cleanup_manager();
+    munmap(header, (size_t)st.st_size);
+
+    printf("[SMOKE] shm: %s\n", g_failures ? "FAILED" : "OK");
+    return g_failures ? 1 : 0;
+}
+
+// ------------- static method -------------
+static void smoke_check(bool ok, const char *what)
+{
+    printf("[SMOKE] %-50s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+    {
+        g_failures++;
+    }
+}
+
+// 신호 파이프를 기다리는 자식 생성 (부모는 go_fd 에 쓰면 시작시킴)
+static pid_t smoke_spawn(smoke_child_t mode, int *go_fd)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        exit(1);
+    }
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[1]);
+        smoke_child(mode, fds[0]);
+        _exit(0);
+    }
+
+    close(fds[0]);
+    *go_fd = fds[1];
+    return pid;
+}
+
+static void smoke_child(smoke_child_t mode, int go_fd)
+{
+    char go;
+    if (read(go_fd, &go, 1) != 1)
+    {
+        _exit(1);
+    }
+
+    can_init_manager(false);
+
+    can_interface_t tx;
+    can_interface_config_t config = {.backend = CAN_BACKEND_SHM, .device = g_device};
+    if (can_create_interface_ex(&tx, "smoke_tx", 0x20 + (uint32_t)mode, &config) != CAN_SUCCESS || can_connect(&tx) != CAN_SUCCESS)
+    {
+        _exit(1);
+    }
+
+    if (mode == SMOKE_CHILD_EXIT)
+    {
+        _exit(0); // 슬롯을 닫지 않음
+    }
+
+    can_frame_t frames[16];
+    memset(frames, 0, sizeof(frames));
+    for (int i = 0; i < 16; i++)
+    {
+        frames[i].id = 0x100 + (uint32_t)i;
+        frames[i].dlc = 1;
+    }
+
+    int sent = 0;
+    while (mode == SMOKE_CHILD_FLOOD || sent < SMOKE_FRAMES)
+    {
+        int n = SMOKE_FRAMES - sent < 16 ? SMOKE_FRAMES - sent : 16;
+        int k = can_send_batch(&tx, frames, mode == SMOKE_CHILD_FLOOD ? 16 : n);
+        if (k > 0)
+        {
+            sent += k;
+        }
+        else
+        {
+            usleep(100);
+        }
+    }
+
+    can_destroy_interface(&tx);
+    can_cleanup_manager();
+    _exit(0);
+}
+
+static void smoke_release(int go_fd)
+{
+    char go = 1;
+    if (write(go_fd, &go, 1) != 1)
+    {
+        g_failures++;
+    }
+    close(go_fd);
+}
+
+static can_shm_slot_t *smoke_slot(can_shm_header_t *header, uint32_t index)
+{
+    size_t header_size = (sizeof(can_shm_header_t) + CAN_CACHELINE_SIZE - 1) & ~(size_t)(CAN_CACHELINE_SIZE - 1);
+    return (can_shm_slot_t *)((char *)header + header_size + header->slot_stride * index);
+}
+
+static int smoke_find_slot(can_shm_header_t *header, int32_t pid)
+{
+    for (uint32_t i = 0; i < header->slot_cnt; i++)
+    {
+        if (atomic_load(&smoke_slot(header, i)->owner_pid) == pid)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// want 개를 받거나 더 이상 오지 않을 때까지 수신
+static int smoke_receive(can_interface_t *rx, int want)
+{
+    can_frame_t frames[64];
+    int total = 0;
+    while (total < want)
+    {
+        int n = can_receive_batch(rx, frames, 64, SMOKE_TIMEOUT_MS);
+        if (n <= 0)
+        {
+            break;
+        }
+        total += n;
+    }
+    return total;
+}
+
+static bool smoke_connect_rx(can_interface_t *rx)
+{
+    can_interface_config_t config = {.backend = CAN_BACKEND_SHM, .device = g_device};
+    return can_create_interface_ex(rx, "smoke_rx", 0x10, &config) == CAN_SUCCESS && can_connect(rx) == CAN_SUCCESS;
+}
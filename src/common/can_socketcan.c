@@ -0,0 +1,512 @@
+#ifdef __linux__
+#define _GNU_SOURCE // sendmmsg/recvmmsg
+#endif
+
+#include "include/can_backend.h"
+#include "include/can_clock.h"
+#include "include/can_epoch.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#endif
+
+static can_error_t can_socketcan_open(can_endpoint_t *endpoint);
+static void can_socketcan_close(can_endpoint_t *endpoint);
+static int can_socketcan_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+static int can_socketcan_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms);
+static int can_socketcan_event_fd(can_endpoint_t *endpoint);
+static void can_socketcan_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank);
+
+// Linux SocketCAN (CAN_RAW 소켓, 배치 시스템 콜, 커널 수신 시각, 커널 필터)
+const can_backend_t g_can_socketcan_backend = {
+    .name = "socketcan",
+    .open = can_socketcan_open,
+    .close = can_socketcan_close,
+    .send = can_socketcan_send,
+    .receive = can_socketcan_receive,
+    .event_fd = can_socketcan_event_fd,
+    .set_filter = can_socketcan_set_filter};
+
+#ifdef __linux__
+static int can_socketcan_decode(can_endpoint_t *endpoint, struct mmsghdr *msgs, const struct can_frame *raw, int n,
+                                can_frame_t *frames);
+static uint64_t can_socketcan_timestamp(struct msghdr *msg, int64_t realtime_offset_ns);
+static int64_t can_realtime_offset_ns(void);
+static void can_socketcan_apply_filter(int fd, const can_filter_bank_t *bank);
+static int can_socketcan_build_filters(const can_filter_bank_t *bank, struct can_filter *filters, int max);
+static int can_socketcan_add_range(struct can_filter *filters, int cnt, int max, uint32_t first, uint32_t last,
+                                   bool is_extended);
+#endif
+
+// ------------- static method -------------
+#ifdef __linux__
+// 장치에 CAN_RAW 소켓을 bind (SO_TIMESTAMPING 을 지원하지 않으면 수신 시점의 시각 사용)
+static can_error_t can_socketcan_open(can_endpoint_t *endpoint)
+{
+    if (atomic_load(&endpoint->sock_fd) >= 0)
+    {
+        return CAN_SUCCESS;
+    }
+
+    int fd = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
+    if (fd < 0)
+    {
+        printf("[CAN] Failed to open SocketCAN socket for '%s': %s\n", endpoint->device, strerror(errno));
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    size_t name_len = strlen(endpoint->device);
+    if (name_len >= sizeof(ifr.ifr_name))
+    {
+        printf("[CAN] SocketCAN device name too long: '%s'\n", endpoint->device);
+        close(fd);
+        return CAN_ERROR_INIT_FAILED;
+    }
+    memcpy(ifr.ifr_name, endpoint->device, name_len);
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0)
+    {
+        printf("[CAN] SocketCAN device '%s' not found\n", endpoint->device);
+        close(fd);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    struct sockaddr_can addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        printf("[CAN] Failed to bind SocketCAN device '%s': %s\n", endpoint->device, strerror(errno));
+        close(fd);
+        return CAN_ERROR_INIT_FAILED;
+    }
+
+    int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) < 0)
+    {
+        printf("[CAN] SO_TIMESTAMPING not available on '%s'\n", endpoint->device);
+    }
+
+    int expected = -1;
+    if (!atomic_compare_exchange_strong(&endpoint->sock_fd, &expected, fd))
+    {
+        // 다른 스레드가 먼저 열었음
+        close(fd);
+        return CAN_SUCCESS;
+    }
+
+    // 연결 전에 설치된 필터 반영 (그 사이 바뀌었으면 다시 읽어 마지막 필터로 맞춤)
+    can_epoch_enter();
+    const can_filter_bank_t *bank = atomic_load(&endpoint->filter);
+    while (1)
+    {
+        can_socketcan_apply_filter(fd, bank);
+
+        const can_filter_bank_t *curr = atomic_load(&endpoint->filter);
+        if (curr == bank)
+        {
+            break;
+        }
+        bank = curr;
+    }
+    can_epoch_exit();
+
+    return CAN_SUCCESS;
+}
+
+static void can_socketcan_close(can_endpoint_t *endpoint)
+{
+    int fd = atomic_exchange(&endpoint->sock_fd, -1);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+// CAN_SOCKETCAN_BATCH 개씩 sendmmsg (송신 버퍼가 가득 차면 보낸 만큼만 반환)
+// 장치가 내려가는 등 다른 에러는 하나도 못 보냈을 때 CAN_ERROR_SEND_FAILED
+static int can_socketcan_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    (void)timestamp_ns; // 송신 시각은 커널이 다시 찍음
+
+    int fd = atomic_load(&endpoint->sock_fd);
+    if (fd < 0)
+    {
+        return CAN_ERROR_NOT_CONNECTED;
+    }
+
+    struct can_frame raw[CAN_SOCKETCAN_BATCH];
+    struct iovec iov[CAN_SOCKETCAN_BATCH];
+    struct mmsghdr msgs[CAN_SOCKETCAN_BATCH];
+    int sent = 0;
+
+    while (sent < n)
+    {
+        int batch = (n - sent) < CAN_SOCKETCAN_BATCH ? (n - sent) : CAN_SOCKETCAN_BATCH;
+        memset(msgs, 0, sizeof(struct mmsghdr) * (size_t)batch);
+
+        for (int i = 0; i < batch; i++)
+        {
+            const can_frame_t *frame = &frames[sent + i];
+            memset(&raw[i], 0, sizeof(struct can_frame));
+            raw[i].can_id = frame->is_extended ? ((frame->id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (frame->id & CAN_SFF_MASK);
+            if (frame->is_remote)
+            {
+                raw[i].can_id |= CAN_RTR_FLAG;
+            }
+            raw[i].can_dlc = frame->dlc;
+            memcpy(raw[i].data, frame->data, frame->dlc);
+
+            iov[i].iov_base = &raw[i];
+            iov[i].iov_len = sizeof(struct can_frame);
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int k = sendmmsg(fd, msgs, (unsigned int)batch, 0);
+        if (k < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno != ENOBUFS && errno != EAGAIN && errno != EWOULDBLOCK && sent == 0)
+            {
+                return CAN_ERROR_SEND_FAILED;
+            }
+            break; // 송신 버퍼 부족이거나 앞부분은 보냄: 보낸 만큼만 반환
+        }
+
+        sent += k;
+        if (k < batch)
+        {
+            break;
+        }
+    }
+
+    return sent;
+}
+
+// recvmmsg 로 쌓인 메시지를 한 번에 읽음 (필터는 수신 후 적용)
+static int can_socketcan_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms)
+{
+    int fd = atomic_load(&endpoint->sock_fd);
+    if (fd < 0)
+    {
+        return CAN_ERROR_NOT_CONNECTED;
+    }
+
+    uint64_t deadline_ns = CAN_DEADLINE_NONE;
+    if (timeout_ms > 0)
+    {
+        deadline_ns = can_monotonic_ns() + (uint64_t)timeout_ms * 1000000ull;
+    }
+
+    int batch = max < CAN_SOCKETCAN_BATCH ? max : CAN_SOCKETCAN_BATCH;
+    struct can_frame raw[CAN_SOCKETCAN_BATCH];
+    struct iovec iov[CAN_SOCKETCAN_BATCH];
+    struct mmsghdr msgs[CAN_SOCKETCAN_BATCH];
+    char control[CAN_SOCKETCAN_BATCH][CMSG_SPACE(sizeof(struct scm_timestamping))];
+
+    while (1)
+    {
+        memset(msgs, 0, sizeof(struct mmsghdr) * (size_t)batch);
+        for (int i = 0; i < batch; i++)
+        {
+            iov[i].iov_base = &raw[i];
+            iov[i].iov_len = sizeof(struct can_frame);
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = control[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(control[i]);
+        }
+
+        int n = recvmmsg(fd, msgs, (unsigned int)batch, MSG_DONTWAIT, NULL);
+        if (n > 0)
+        {
+            int received = can_socketcan_decode(endpoint, msgs, raw, n, frames);
+            if (received > 0)
+            {
+                return received;
+            }
+            continue; // 모두 걸러짐
+        }
+
+        if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        if (timeout_ms == 0)
+        {
+            return CAN_ERROR_RECV_FAILED;
+        }
+
+        // 연결 해제를 알아챌 수 있도록 나누어 대기
+        int wait_ms = CAN_SOCKETCAN_POLL_SLICE_MS;
+        if (deadline_ns != CAN_DEADLINE_NONE)
+        {
+            uint64_t now = can_monotonic_ns();
+            if (now >= deadline_ns)
+            {
+                return CAN_ERROR_RECV_FAILED;
+            }
+
+            uint64_t remaining_ms = (deadline_ns - now + 999999ull) / 1000000ull;
+            if (remaining_ms < (uint64_t)wait_ms)
+            {
+                wait_ms = (int)remaining_ms;
+            }
+        }
+
+        struct pollfd pfd = {.fd = fd, .events = POLLIN};
+        poll(&pfd, 1, wait_ms);
+
+        if (!atomic_load(&endpoint->is_connected))
+        {
+            return CAN_ERROR_NOT_CONNECTED;
+        }
+    }
+}
+
+// 소켓 자체가 readable 알림 핸들
+static int can_socketcan_event_fd(can_endpoint_t *endpoint)
+{
+    return atomic_load(&endpoint->sock_fd);
+}
+
+// 필터가 바뀌면 커널 필터도 갱신 (열리기 전이면 open 에서 설치)
+static void can_socketcan_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank)
+{
+    int fd = atomic_load(&endpoint->sock_fd);
+    if (fd >= 0)
+    {
+        can_socketcan_apply_filter(fd, bank);
+    }
+}
+
+// 커널 메시지를 can_frame_t 로 변환 (에러 프레임과 필터에 걸린 메시지는 제외)
+// 커널 필터가 설치되어 있어도 교체 직전에 쌓인 메시지나 상한을 넘은 필터 때문에 수신 후 검사는 유지
+static int can_socketcan_decode(can_endpoint_t *endpoint, struct mmsghdr *msgs, const struct can_frame *raw, int n,
+                                can_frame_t *frames)
+{
+    can_epoch_enter();
+    const can_filter_bank_t *filter = atomic_load_explicit(&endpoint->filter, memory_order_acquire);
+    int64_t realtime_offset_ns = can_realtime_offset_ns();
+    int received = 0;
+    uint64_t rejected = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (msgs[i].msg_len < sizeof(struct can_frame) || (raw[i].can_id & CAN_ERR_FLAG))
+        {
+            continue;
+        }
+
+        bool is_extended = (raw[i].can_id & CAN_EFF_FLAG) != 0;
+        uint32_t id = raw[i].can_id & (is_extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+        if (filter && !can_filter_bank_accept(filter, id, is_extended))
+        {
+            rejected++;
+            continue;
+        }
+
+        can_frame_t *frame = &frames[received++];
+        memset(frame, 0, sizeof(can_frame_t));
+        frame->id = id;
+        frame->is_extended = is_extended;
+        frame->is_remote = (raw[i].can_id & CAN_RTR_FLAG) != 0;
+        frame->dlc = raw[i].can_dlc > CAN_MAX_DATA_LENGTH ? CAN_MAX_DATA_LENGTH : raw[i].can_dlc;
+        memcpy(frame->data, raw[i].data, frame->dlc);
+        frame->timestamp_ns = can_socketcan_timestamp(&msgs[i].msg_hdr, realtime_offset_ns);
+    }
+    can_epoch_exit();
+
+    can_metrics_add(&endpoint->metrics, CAN_METRIC_FILTER_REJECTS, rejected);
+    return received;
+}
+
+// 커널 수신 시각 (CLOCK_REALTIME) 을 CLOCK_MONOTONIC 기준으로 변환 (없거나 가상 시계이면 현재 시각)
+static uint64_t can_socketcan_timestamp(struct msghdr *msg, int64_t realtime_offset_ns)
+{
+    if (can_clock_is_virtual())
+    {
+        return can_clock_now_ns();
+    }
+
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg); cmsg; cmsg = CMSG_NXTHDR(msg, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SO_TIMESTAMPING)
+        {
+            continue;
+        }
+
+        struct scm_timestamping stamps;
+        memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+        int64_t realtime_ns = (int64_t)stamps.ts[0].tv_sec * 1000000000ll + stamps.ts[0].tv_nsec;
+        if (realtime_ns > 0)
+        {
+            return (uint64_t)(realtime_ns - realtime_offset_ns);
+        }
+    }
+
+    return can_monotonic_ns();
+}
+
+// CLOCK_REALTIME - CLOCK_MONOTONIC
+static int64_t can_realtime_offset_ns(void)
+{
+    struct timespec realtime;
+    clock_gettime(CLOCK_REALTIME, &realtime);
+    uint64_t monotonic_ns = can_monotonic_ns();
+
+    return (int64_t)realtime.tv_sec * 1000000000ll + realtime.tv_nsec - (int64_t)monotonic_ns;
+}
+
+// 필터 뱅크를 CAN_RAW_FILTER 로 설치 (bank 가 NULL 이거나 상한을 넘으면 모두 수신)
+static void can_socketcan_apply_filter(int fd, const can_filter_bank_t *bank)
+{
+    struct can_filter filters[CAN_SOCKETCAN_MAX_FILTERS];
+    int cnt = bank ? can_socketcan_build_filters(bank, filters, CAN_SOCKETCAN_MAX_FILTERS) : -1;
+    if (cnt >= 0 &&
+        setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, filters, (socklen_t)(sizeof(struct can_filter) * (size_t)cnt)) == 0)
+    {
+        return;
+    }
+
+    if (cnt >= 0)
+    {
+        printf("[CAN] Failed to set CAN_RAW_FILTER (%d entries): %s\n", cnt, strerror(errno));
+    }
+
+    // 이전 커널 필터가 남아 새 필터가 허용하는 메시지를 버리지 않도록 모두 받음
+    struct can_filter all = {.can_id = 0, .can_mask = 0};
+    setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, &all, sizeof(all));
+}
+
+// 표준 ID 비트맵의 연속 구간과 확장 ID 범위는 정렬된 블록(id/mask)으로 나누고 확장 마스크는 그대로 옮김
+// (max 개를 넘으면 -1, 빈 뱅크는 0개 = 모두 거부)
+static int can_socketcan_build_filters(const can_filter_bank_t *bank, struct can_filter *filters, int max)
+{
+    int cnt = 0;
+
+    uint32_t id = 0;
+    while (id < CAN_STD_ID_COUNT && cnt >= 0)
+    {
+        if (!((bank->std_bitmap[id >> 6] >> (id & 63)) & 1))
+        {
+            id++;
+            continue;
+        }
+
+        uint32_t first = id;
+        while (id < CAN_STD_ID_COUNT && ((bank->std_bitmap[id >> 6] >> (id & 63)) & 1))
+        {
+            id++;
+        }
+        cnt = can_socketcan_add_range(filters, cnt, max, first, id - 1, false);
+    }
+
+    for (uint32_t i = 0; i < bank->ext_range_cnt && cnt >= 0; i++)
+    {
+        cnt = can_socketcan_add_range(filters, cnt, max, bank->ext_ranges[i].first, bank->ext_ranges[i].last, true);
+    }
+
+    for (uint32_t i = 0; i < bank->ext_mask_cnt && cnt >= 0; i++)
+    {
+        if (cnt == max)
+        {
+            return -1;
+        }
+        filters[cnt].can_id = bank->ext_masks[i].id | CAN_EFF_FLAG;
+        filters[cnt].can_mask = bank->ext_masks[i].mask | CAN_EFF_FLAG;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+// [first, last] 를 2의 거듭제곱 크기로 정렬된 블록들로 나누어 추가 (마스크에 EFF 플래그를 넣어 프레임 종류도 구분)
+static int can_socketcan_add_range(struct can_filter *filters, int cnt, int max, uint32_t first, uint32_t last,
+                                   bool is_extended)
+{
+    uint64_t id_mask = is_extended ? CAN_EFF_MASK : CAN_SFF_MASK;
+    uint64_t id = first;
+
+    while (id <= last)
+    {
+        // id 에 정렬되고 last 를 넘지 않는 가장 큰 블록
+        uint64_t size = id ? (id & (~id + 1)) : id_mask + 1;
+        while (id + size - 1 > last)
+        {
+            size >>= 1;
+        }
+
+        if (cnt == max)
+        {
+            return -1;
+        }
+        filters[cnt].can_id = (canid_t)id | (is_extended ? CAN_EFF_FLAG : 0);
+        filters[cnt].can_mask = (canid_t)(~(size - 1) & id_mask) | CAN_EFF_FLAG;
+        cnt++;
+        id += size;
+    }
+
+    return cnt;
+}
+#else
+static can_error_t can_socketcan_open(can_endpoint_t *endpoint)
+{
+    printf("[CAN] SocketCAN is not supported on this platform ('%s')\n", endpoint->device);
+    return CAN_ERROR_INIT_FAILED;
+}
+
+static void can_socketcan_close(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+}
+
+static int can_socketcan_send(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns)
+{
+    (void)endpoint;
+    (void)frames;
+    (void)n;
+    (void)timestamp_ns;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+static int can_socketcan_receive(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms)
+{
+    (void)endpoint;
+    (void)frames;
+    (void)max;
+    (void)timeout_ms;
+    return CAN_ERROR_NOT_CONNECTED;
+}
+
+static int can_socketcan_event_fd(can_endpoint_t *endpoint)
+{
+    (void)endpoint;
+    return -1;
+}
+
+static void can_socketcan_set_filter(can_endpoint_t *endpoint, const can_filter_bank_t *bank)
+{
+    (void)endpoint;
+    (void)bank;
+}
+#endif
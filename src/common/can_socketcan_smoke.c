@@ -0,0 +1,170 @@
+// SocketCAN 백엔드 vcan 점검 (송수신, 커널 CAN_RAW_FILTER 설치/해제, 연결 전 설치한 필터)
+// 준비: sudo modprobe vcan && sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+// 빌드: gcc -O2 -std=gnu11 -pthread -o can_socketcan_smoke $(ls src/common/*.c | grep -v _smoke.c) src/common/can_socketcan_smoke.c -lm
+// 실행: ./can_socketcan_smoke [장치 (기본 vcan0)]
+#include "include/can_interface.h"
+#include "include/can_filter.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#define SMOKE_FRAMES 256
+#define SMOKE_TIMEOUT_MS 200
+#define SMOKE_MAX_FILTERS 64
+
+static int g_failures = 0;
+
+static void smoke_check(bool ok, const char *what);
+static can_frame_t smoke_frame(uint32_t id, bool is_extended, uint8_t seq);
+static int smoke_receive_all(can_interface_t *rx, can_frame_t *frames, int max);
+static int smoke_kernel_filters(can_interface_t *can_interface, struct can_filter *filters, int max);
+
+int main(int argc, char *argv[])
+{
+    const char *device = argc > 1 ? argv[1] : "vcan0";
+
+    if (can_init_manager(false) != CAN_SUCCESS)
+    {
+        printf("[SMOKE] Failed to init CAN manager\n");
+        return 1;
+    }
+
+    can_interface_config_t config = {.backend = CAN_BACKEND_SOCKETCAN, .device = device};
+    can_interface_t tx;
+    can_interface_t rx;
+    can_interface_t late;
+    if (can_create_interface_ex(&tx, "smoke_tx", 0x01, &config) != CAN_SUCCESS ||
+        can_create_interface_ex(&rx, "smoke_rx", 0x02, &config) != CAN_SUCCESS ||
+        can_create_interface_ex(&late, "smoke_late", 0x03, &config) != CAN_SUCCESS)
+    {
+        printf("[SMOKE] Failed to create interfaces\n");
+        can_cleanup_manager();
+        return 1;
+    }
+
+    // 연결 전에 필터를 걸어 open 에서 커널 필터로 옮겨지는지 확인
+    can_filter_rule_t late_rule = can_filter_range_rule(0x100, 0x1FF, false);
+    smoke_check(can_set_filter_bank(&late, &late_rule, 1) == CAN_SUCCESS, "filter before connect");
+
+    if (can_connect(&tx) != CAN_SUCCESS || can_connect(&rx) != CAN_SUCCESS || can_connect(&late) != CAN_SUCCESS)
+    {
+        printf("[SMOKE] Failed to connect to '%s' (vcan 장치가 올라와 있는지 확인)\n", device);
+        can_cleanup_manager();
+        return 1;
+    }
+
+    struct can_filter filters[SMOKE_MAX_FILTERS];
+    int cnt = smoke_kernel_filters(&late, filters, SMOKE_MAX_FILTERS);
+    smoke_check(cnt == 1 && filters[0].can_id == 0x100 && filters[0].can_mask == (0x700 | CAN_EFF_FLAG),
+                "filter set before connect is installed in kernel");
+
+    // 1. 필터 없이 송수신
+    can_frame_t sent[SMOKE_FRAMES];
+    can_frame_t received[SMOKE_FRAMES * 2];
+    for (int i = 0; i < SMOKE_FRAMES; i++)
+    {
+        sent[i] = smoke_frame((uint32_t)(i * 8) & CAN_STD_ID_MASK, false, (uint8_t)i);
+    }
+    smoke_check(can_send_batch(&tx, sent, SMOKE_FRAMES) == SMOKE_FRAMES, "send batch");
+
+    int n = smoke_receive_all(&rx, received, SMOKE_FRAMES * 2);
+    bool same = n == SMOKE_FRAMES;
+    for (int i = 0; same && i < n; i++)
+    {
+        same = received[i].id == sent[i].id && received[i].dlc == sent[i].dlc &&
+               memcmp(received[i].data, sent[i].data, sent[i].dlc) == 0;
+    }
+    smoke_check(same, "round trip without filter");
+    smoke_check(smoke_kernel_filters(&rx, filters, SMOKE_MAX_FILTERS) == 1 && filters[0].can_mask == 0,
+                "default kernel filter accepts all");
+
+    // 2. 표준 범위 + 확장 마스크 필터: 커널에서 걸러지고 통과한 것만 수신
+    can_filter_rule_t rules[] = {
+        can_filter_range_rule(0x100, 0x17F, false),
+        can_filter_mask_rule(0x18FF0000, 0x1FFF00F0, true)};
+    smoke_check(can_set_filter_bank(&rx, rules, 2) == CAN_SUCCESS, "set filter bank");
+
+    cnt = smoke_kernel_filters(&rx, filters, SMOKE_MAX_FILTERS);
+    smoke_check(cnt == 2, "kernel filter entries for range + mask");
+
+    can_frame_t mixed[6] = {
+        smoke_frame(0x0FF, false, 0),
+        smoke_frame(0x100, false, 1),      // 통과
+        smoke_frame(0x17F, false, 2),      // 통과
+        smoke_frame(0x180, false, 3),
+        smoke_frame(0x18FF1203, true, 4),  // 통과
+        smoke_frame(0x18FF1213, true, 5)};
+    smoke_check(can_send_batch(&tx, mixed, 6) == 6, "send mixed ids");
+
+    n = smoke_receive_all(&rx, received, SMOKE_FRAMES * 2);
+    smoke_check(n == 3 && received[0].id == 0x100 && received[1].id == 0x17F &&
+                    received[2].id == 0x18FF1203 && received[2].is_extended,
+                "only accepted ids are received");
+
+    // 3. 해제하면 다시 모두 수신
+    smoke_check(can_clear_filter(&rx) == CAN_SUCCESS, "clear filter");
+    cnt = smoke_kernel_filters(&rx, filters, SMOKE_MAX_FILTERS);
+    smoke_check(cnt == 1 && filters[0].can_id == 0 && filters[0].can_mask == 0, "cleared kernel filter accepts all");
+
+    smoke_check(can_send_batch(&tx, mixed, 6) == 6, "send mixed ids again");
+    smoke_check(smoke_receive_all(&rx, received, SMOKE_FRAMES * 2) == 6, "all ids received after clear");
+
+    can_cleanup_manager();
+
+    printf("[SMOKE] %s: %s\n", device, g_failures ? "FAILED" : "OK");
+    return g_failures ? 1 : 0;
+}
+
+// ------------- static method -------------
+static void smoke_check(bool ok, const char *what)
+{
+    printf("[SMOKE] %-50s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+    {
+        g_failures++;
+    }
+}
+
+static can_frame_t smoke_frame(uint32_t id, bool is_extended, uint8_t seq)
+{
+    can_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = id;
+    frame.is_extended = is_extended;
+    frame.dlc = 4;
+    frame.data[0] = seq;
+    frame.data[1] = (uint8_t)(id >> 8);
+    frame.data[2] = (uint8_t)id;
+    frame.data[3] = 0xA5;
+    return frame;
+}
+
+// 더 이상 오지 않을 때까지 수신
+static int smoke_receive_all(can_interface_t *rx, can_frame_t *frames, int max)
+{
+    int total = 0;
+    while (total < max)
+    {
+        int n = can_receive_batch(rx, frames + total, max - total, SMOKE_TIMEOUT_MS);
+        if (n <= 0)
+        {
+            break;
+        }
+        total += n;
+    }
+    return total;
+}
+
+// 소켓에 설치된 커널 필터 (event fd 가 CAN_RAW 소켓)
+static int smoke_kernel_filters(can_interface_t *can_interface, struct can_filter *filters, int max)
+{
+    int fd = can_get_event_fd(can_interface);
+    socklen_t len = (socklen_t)(sizeof(struct can_filter) * (size_t)max);
+    if (fd < 0 || getsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, filters, &len) < 0)
+    {
+        return -1;
+    }
+    return (int)(len / sizeof(struct can_filter));
+}
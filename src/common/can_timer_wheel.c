@@ -0,0 +1,285 @@
+#include "include/can_timer_wheel.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CAN_TIMER_WHEEL_MASK (CAN_TIMER_WHEEL_SLOTS - 1)
+
+static void can_timer_wheel_place(can_timer_wheel_t *wheel, uint32_t timer_id, uint64_t earliest_tick);
+static void can_timer_wheel_unlink(can_timer_wheel_t *wheel, uint32_t timer_id);
+static void can_timer_wheel_cascade(can_timer_wheel_t *wheel, uint32_t bucket);
+static uint32_t can_timer_wheel_detach(can_timer_wheel_t *wheel, uint32_t bucket);
+static uint32_t can_timer_wheel_find(const can_timer_wheel_t *wheel, uint32_t level, uint32_t from);
+
+bool can_timer_wheel_init(can_timer_wheel_t *wheel, uint32_t capacity, uint64_t start_tick)
+{
+    if (!wheel || capacity == 0 || capacity == CAN_TIMER_NONE)
+    {
+        return false;
+    }
+
+    memset(wheel, 0, sizeof(can_timer_wheel_t));
+    wheel->expiry = calloc(capacity, sizeof(uint64_t));
+    wheel->next = malloc(sizeof(uint32_t) * capacity);
+    wheel->prev = malloc(sizeof(uint32_t) * capacity);
+    wheel->bucket = malloc(sizeof(uint32_t) * capacity);
+    if (!wheel->expiry || !wheel->next || !wheel->prev || !wheel->bucket)
+    {
+        can_timer_wheel_free(wheel);
+        return false;
+    }
+
+    wheel->capacity = capacity;
+    wheel->now_tick = start_tick;
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        wheel->bucket[i] = CAN_TIMER_NONE;
+    }
+    for (uint32_t i = 0; i < CAN_TIMER_WHEEL_LEVELS * CAN_TIMER_WHEEL_SLOTS; i++)
+    {
+        wheel->heads[i] = CAN_TIMER_NONE;
+    }
+
+    return true;
+}
+
+void can_timer_wheel_free(can_timer_wheel_t *wheel)
+{
+    if (!wheel)
+    {
+        return;
+    }
+
+    free(wheel->expiry);
+    free(wheel->next);
+    free(wheel->prev);
+    free(wheel->bucket);
+    memset(wheel, 0, sizeof(can_timer_wheel_t));
+}
+
+// 타이머를 expiry_tick 에 걸기 (이미 걸려있으면 옮김, 지난 시각이면 다음 틱에 만료)
+void can_timer_wheel_arm(can_timer_wheel_t *wheel, uint32_t timer_id, uint64_t expiry_tick)
+{
+    if (timer_id >= wheel->capacity)
+    {
+        return;
+    }
+
+    if (wheel->bucket[timer_id] != CAN_TIMER_NONE)
+    {
+        can_timer_wheel_unlink(wheel, timer_id);
+    }
+    else
+    {
+        wheel->armed_cnt++;
+    }
+
+    wheel->expiry[timer_id] = expiry_tick;
+    can_timer_wheel_place(wheel, timer_id, wheel->now_tick + 1);
+}
+
+void can_timer_wheel_cancel(can_timer_wheel_t *wheel, uint32_t timer_id)
+{
+    if (timer_id >= wheel->capacity || wheel->bucket[timer_id] == CAN_TIMER_NONE)
+    {
+        return;
+    }
+
+    can_timer_wheel_unlink(wheel, timer_id);
+    wheel->armed_cnt--;
+}
+
+bool can_timer_wheel_is_armed(const can_timer_wheel_t *wheel, uint32_t timer_id)
+{
+    return timer_id < wheel->capacity && wheel->bucket[timer_id] != CAN_TIMER_NONE;
+}
+
+// 다음에 처리할 일이 있는 틱 (0단계 만료 또는 상위 단계 내림, 다음 만료의 하한, 없으면 CAN_TIMER_TICK_NONE)
+uint64_t can_timer_wheel_next_tick(const can_timer_wheel_t *wheel)
+{
+    if (wheel->armed_cnt == 0)
+    {
+        return CAN_TIMER_TICK_NONE;
+    }
+
+    uint64_t next = CAN_TIMER_TICK_NONE;
+    for (uint32_t level = 0; level < CAN_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t shift = CAN_TIMER_WHEEL_BITS * level;
+        uint64_t base = wheel->now_tick >> shift;
+
+        // 현재 위치 다음 슬롯부터 한 바퀴 (현재 위치 슬롯은 한 바퀴 뒤에 처리됨)
+        uint32_t offset = can_timer_wheel_find(wheel, level, (uint32_t)(base + 1) & CAN_TIMER_WHEEL_MASK);
+        if (offset == 0)
+        {
+            continue;
+        }
+
+        uint64_t tick = (base + offset) << shift;
+        if (tick < next)
+        {
+            next = tick;
+        }
+    }
+
+    return next;
+}
+
+// now_tick 까지 틱을 진행하며 만료된 타이머마다 fn 호출 (할 일이 없는 틱은 건너뜀, 호출한 횟수 반환)
+uint32_t can_timer_wheel_advance(can_timer_wheel_t *wheel, uint64_t now_tick, can_timer_fn_t fn, void *ctx)
+{
+    uint32_t fired = 0;
+
+    while (wheel->now_tick < now_tick)
+    {
+        uint64_t tick = can_timer_wheel_next_tick(wheel);
+        if (tick > now_tick)
+        {
+            wheel->now_tick = now_tick;
+            break;
+        }
+
+        wheel->now_tick = tick;
+
+        // 하위 단계가 한 바퀴 돌 때마다 상위 단계 슬롯을 아래로 내림
+        for (uint32_t level = 1; level < CAN_TIMER_WHEEL_LEVELS; level++)
+        {
+            if ((tick & ((1ull << (CAN_TIMER_WHEEL_BITS * level)) - 1)) != 0)
+            {
+                break;
+            }
+            uint32_t slot = (uint32_t)(tick >> (CAN_TIMER_WHEEL_BITS * level)) & CAN_TIMER_WHEEL_MASK;
+            can_timer_wheel_cascade(wheel, level * CAN_TIMER_WHEEL_SLOTS + slot);
+        }
+
+        // 0단계 슬롯의 타이머를 모두 만료 (콜백이 같은 슬롯에 다시 걸 수 있으므로 먼저 떼어냄)
+        uint32_t timer_id = can_timer_wheel_detach(wheel, (uint32_t)tick & CAN_TIMER_WHEEL_MASK);
+
+        while (timer_id != CAN_TIMER_NONE)
+        {
+            uint32_t next = wheel->next[timer_id];
+            wheel->bucket[timer_id] = CAN_TIMER_NONE;
+            wheel->armed_cnt--;
+            fn(ctx, timer_id, wheel->expiry[timer_id]);
+            fired++;
+            timer_id = next;
+        }
+    }
+
+    return fired;
+}
+
+// ------------- static method -------------
+// 남은 틱 수로 단계를 고르고 만료 틱의 해당 자릿수를 슬롯으로 사용 (earliest_tick 보다 이르면 earliest_tick 에 만료)
+static void can_timer_wheel_place(can_timer_wheel_t *wheel, uint32_t timer_id, uint64_t earliest_tick)
+{
+    uint64_t expiry = wheel->expiry[timer_id];
+    if (expiry < earliest_tick)
+    {
+        expiry = earliest_tick;
+    }
+
+    uint64_t delta = expiry - wheel->now_tick;
+    uint32_t level = 0;
+    while (level < CAN_TIMER_WHEEL_LEVELS - 1 && delta >= (1ull << (CAN_TIMER_WHEEL_BITS * (level + 1))))
+    {
+        level++;
+    }
+
+    // 최상위 단계보다 먼 타이머는 한 바퀴 끝에 두고 내려올 때 다시 배치
+    uint64_t horizon = 1ull << (CAN_TIMER_WHEEL_BITS * CAN_TIMER_WHEEL_LEVELS);
+    if (delta >= horizon)
+    {
+        expiry = wheel->now_tick + horizon - 1;
+    }
+
+    uint32_t bucket = level * CAN_TIMER_WHEEL_SLOTS + ((uint32_t)(expiry >> (CAN_TIMER_WHEEL_BITS * level)) & CAN_TIMER_WHEEL_MASK);
+    uint32_t head = wheel->heads[bucket];
+
+    wheel->bucket[timer_id] = bucket;
+    wheel->occupied[bucket / 64] |= 1ull << (bucket % 64);
+    wheel->prev[timer_id] = CAN_TIMER_NONE;
+    wheel->next[timer_id] = head;
+    if (head != CAN_TIMER_NONE)
+    {
+        wheel->prev[head] = timer_id;
+    }
+    wheel->heads[bucket] = timer_id;
+}
+
+static void can_timer_wheel_unlink(can_timer_wheel_t *wheel, uint32_t timer_id)
+{
+    uint32_t prev = wheel->prev[timer_id];
+    uint32_t next = wheel->next[timer_id];
+
+    if (prev != CAN_TIMER_NONE)
+    {
+        wheel->next[prev] = next;
+    }
+    else
+    {
+        uint32_t bucket = wheel->bucket[timer_id];
+        wheel->heads[bucket] = next;
+        if (next == CAN_TIMER_NONE)
+        {
+            wheel->occupied[bucket / 64] &= ~(1ull << (bucket % 64));
+        }
+    }
+
+    if (next != CAN_TIMER_NONE)
+    {
+        wheel->prev[next] = prev;
+    }
+
+    wheel->bucket[timer_id] = CAN_TIMER_NONE;
+}
+
+// 상위 단계 슬롯의 타이머를 현재 틱 기준으로 다시 배치 (이번 틱에 만료될 타이머는 바로 뒤에 처리할 0단계 슬롯으로)
+static void can_timer_wheel_cascade(can_timer_wheel_t *wheel, uint32_t bucket)
+{
+    uint32_t timer_id = can_timer_wheel_detach(wheel, bucket);
+
+    while (timer_id != CAN_TIMER_NONE)
+    {
+        uint32_t next = wheel->next[timer_id];
+        can_timer_wheel_place(wheel, timer_id, wheel->now_tick);
+        timer_id = next;
+    }
+}
+
+// 슬롯의 타이머 목록을 통째로 떼어냄 (목록의 첫 타이머 반환)
+static uint32_t can_timer_wheel_detach(can_timer_wheel_t *wheel, uint32_t bucket)
+{
+    uint32_t timer_id = wheel->heads[bucket];
+    wheel->heads[bucket] = CAN_TIMER_NONE;
+    wheel->occupied[bucket / 64] &= ~(1ull << (bucket % 64));
+    return timer_id;
+}
+
+// level 단계에서 from 슬롯부터 원형으로 처음 비어 있지 않은 슬롯까지의 거리 + 1 (1 ~ 256, 모두 비었으면 0)
+static uint32_t can_timer_wheel_find(const can_timer_wheel_t *wheel, uint32_t level, uint32_t from)
+{
+    const uint64_t *words = &wheel->occupied[level * CAN_TIMER_WHEEL_SLOTS / 64];
+    uint32_t word_cnt = CAN_TIMER_WHEEL_SLOTS / 64;
+
+    for (uint32_t n = 0; n <= word_cnt; n++)
+    {
+        uint32_t w = (from / 64 + n) % word_cnt;
+        uint64_t bits = words[w];
+        if (n == 0)
+        {
+            bits &= ~0ull << (from % 64);
+        }
+        else if (n == word_cnt)
+        {
+            bits &= (from % 64) ? ~(~0ull << (from % 64)) : 0;
+        }
+
+        if (bits)
+        {
+            uint32_t slot = w * 64 + (uint32_t)__builtin_ctzll(bits);
+            return ((slot - from) & CAN_TIMER_WHEEL_MASK) + 1;
+        }
+    }
+
+    return 0;
+}
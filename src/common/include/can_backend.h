@@ -0,0 +1,40 @@
+#ifndef CAN_BACKEND_H
+#define CAN_BACKEND_H
+
+#include "can_interface.h"
+#include "can_registry.h"
+#include <stdint.h>
+
+#define CAN_SOCKETCAN_BATCH 64        // sendmmsg/recvmmsg 한 번에 처리하는 메시지 수
+#define CAN_SOCKETCAN_POLL_SLICE_MS 100 // 블로킹 수신 중 연결 상태를 다시 확인하는 주기
+#define CAN_SOCKETCAN_MAX_FILTERS 64    // 커널 CAN_RAW_FILTER 항목 수 상한 (넘으면 모두 받고 수신 후 검사만 사용)
+
+// 인터페이스 송수신 구현 (can_connect/can_send/can_receive 아래에서 호출)
+typedef struct can_backend
+{
+    const char *name;
+
+    // 연결 시 장치를 열고 해제 시 닫음 (이미 열려 있으면 open 은 바로 성공)
+    can_error_t (*open)(can_endpoint_t *endpoint);
+    void (*close)(can_endpoint_t *endpoint);
+
+    // 송신한 메시지 수 또는 음수 에러 코드 (메시지에는 timestamp_ns 를 찍어서 보냄)
+    int (*send)(can_endpoint_t *endpoint, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+
+    // 수신한 메시지 수 또는 음수 에러 코드 (timeout_ms: 0 이면 바로 반환, 음수면 무기한)
+    int (*receive)(can_endpoint_t *endpoint, can_frame_t *frames, int max, int timeout_ms);
+
+    // epoll 등에 등록할 수 있는 수신 알림 핸들 (-1: 지원하지 않음)
+    int (*event_fd)(can_endpoint_t *endpoint);
+
+    // 필터가 바뀌었을 때 호출 (NULL: endpoint->filter 만 사용, bank 가 NULL 이면 모두 수신)
+    void (*set_filter)(can_endpoint_t *endpoint, const can_filter_bank_t *bank);
+} can_backend_t;
+
+extern const can_backend_t g_can_memory_backend;
+extern const can_backend_t g_can_socketcan_backend;
+extern const can_backend_t g_can_shm_backend;
+
+// function
+const can_backend_t *can_backend_get(can_backend_type_t type);
+#endif
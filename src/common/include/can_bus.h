@@ -0,0 +1,72 @@
+#ifndef CAN_BUS_H
+#define CAN_BUS_H
+
+#include "can_interface.h"
+#include "can_registry.h"
+#include "can_metrics.h"
+#include "can_platform.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define CAN_DEFAULT_BUS 0       // can_create_interface 가 사용하는 버스
+#define CAN_BUS_DRAIN_BATCH 64  // 워커가 송신 큐 하나에서 한 번에 꺼내는 메시지 수
+
+// 버스에 올라간 메시지를 받는 콜백 (워커 버스: 워커 스레드, 워커 없는 버스: 송신 스레드에서 호출)
+// 어느 쪽이든 한 번에 하나의 스레드에서만 호출되므로 콜백은 단일 스레드 상태를 그대로 사용해도 됨 (콜백 안에서 같은 버스로 송신하지 않음)
+typedef void (*can_bus_handler_t)(void *ctx, const can_frame_t *frames, int n);
+
+// 버스 설정
+typedef struct
+{
+    const char *name;
+    bool use_worker;           // true: 송신은 송신 큐에 적재만 하고 전용 워커가 배달
+    bool pin_cpu;              // true: 워커를 cpu 에 고정 (Linux 전용, {0} 으로 초기화하면 고정하지 않음)
+    int cpu;                   // 워커를 고정할 CPU (pin_cpu 가 true 일 때만 사용)
+    can_bus_handler_t handler; // NULL: 콜백 없음
+    void *handler_ctx;
+} can_bus_config_t;
+
+// 버스 통계
+typedef struct
+{
+    uint64_t frames;      // 버스에 올라간 메시지
+    uint64_t undelivered; // 어느 수신 큐에도 들어가지 못한 메시지
+    uint64_t batches;     // 워커가 송신 큐에서 꺼낸 횟수
+    uint64_t wakeups;     // 워커가 대기에서 깨어난 횟수
+    int interface_cnt;
+} can_bus_stats_t;
+
+// 버스 하나 (자신의 인터페이스 집합과 통계를 가지며 다른 버스와 메시지를 주고받지 않음)
+typedef struct can_bus
+{
+    char name[32];
+    uint32_t id;
+    atomic_bool in_use;
+    bool has_worker;
+    int cpu; // -1: 고정하지 않음
+    can_bus_handler_t handler;
+    void *handler_ctx;
+    pthread_mutex_t handler_lock; // 워커 없는 버스에서 여러 송신 스레드의 콜백 호출을 직렬화
+
+    pthread_t worker;
+    atomic_bool running;
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint32_t doorbell; // 워커 깨우기용 futex 워드
+    atomic_bool worker_waiting;                             // 워커가 대기 중인지 여부
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t batches; // 워커만 갱신
+    _Atomic uint64_t wakeups;
+    can_iface_metrics_t metrics; // TX_FRAMES: 버스에 올라간 메시지, TX_ERRORS: 배달되지 못한 메시지
+} can_bus_t;
+
+// function
+bool can_bus_init(void);
+void can_bus_cleanup(void);
+int can_create_bus(const can_bus_config_t *config);
+can_error_t can_get_bus_stats(uint32_t bus_id, can_bus_stats_t *stats);
+can_bus_t *can_bus_get(uint32_t bus_id);
+int can_bus_transmit(can_endpoint_t *source, const can_frame_t *frames, int n, uint64_t timestamp_ns);
+void can_endpoint_signal(can_endpoint_t *endpoint);
+#endif
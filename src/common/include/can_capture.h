@@ -0,0 +1,64 @@
+#ifndef CAN_CAPTURE_H
+#define CAN_CAPTURE_H
+
+#include "can_interface.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define CAN_CAPTURE_MAGIC 0x50414343u // "CCAP" (little endian)
+#define CAN_CAPTURE_VERSION 2
+#define CAN_CAPTURE_RING_RECORDS 16384  // 송신 스레드와 기록 스레드 사이 링 크기 (2의 거듭제곱)
+#define CAN_CAPTURE_BUFFER_RECORDS 4096 // 기록 스레드가 한 번에 파일에 쓰는 레코드 수
+#define CAN_CAPTURE_FLUSH_MS 100        // 버퍼가 덜 찼어도 이 주기로 기록
+#define CAN_CAPTURE_IDLE_MS 1           // 기록 스레드가 링이 비었을 때 쉬는 시간
+
+// 레코드 플래그
+#define CAN_CAPTURE_FLAG_EXTENDED 0x01
+#define CAN_CAPTURE_FLAG_REMOTE 0x02
+
+#define CAN_REPLAY_AS_FAST_AS_POSSIBLE 0.0 // 재생 속도: 대기 없이 송신
+
+#pragma pack(push, 1)
+// 파일 헤더 (16 bytes)
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint64_t start_ns; // 캡처 시작 시각 (CLOCK_MONOTONIC)
+} can_capture_header_t;
+
+// 고정 길이 레코드 (24 bytes)
+typedef struct
+{
+    uint64_t timestamp_ns; // 송신 시각 (CLOCK_MONOTONIC)
+    uint32_t id;
+    uint8_t flags;
+    uint8_t dlc;
+    uint16_t iface_idx; // 송신 인터페이스 슬롯 번호 (핸들 하위 16비트)
+    uint8_t data[CAN_MAX_DATA_LENGTH];
+} can_capture_record_t;
+#pragma pack(pop)
+
+// 재생용 파일 매핑
+typedef struct
+{
+    const can_capture_header_t *header;
+    const can_capture_record_t *records;
+    size_t record_cnt;
+    void *map;
+    size_t map_size;
+} can_replay_t;
+
+// function
+can_capture_t *can_capture_open(const char *path);
+int can_capture_append(can_capture_t *capture, uint64_t timestamp_ns, uint16_t iface_idx, const can_frame_t *frames, int n);
+uint64_t can_capture_dropped(can_capture_t *capture);
+void can_capture_close(can_capture_t *capture);
+
+can_error_t can_replay_open(can_replay_t *replay, const char *path);
+void can_replay_close(can_replay_t *replay);
+void can_replay_to_frame(const can_capture_record_t *record, can_frame_t *frame);
+int64_t can_replay_run(const can_replay_t *replay, can_interface_t *can_interface, double speed);
+#endif
@@ -0,0 +1,25 @@
+#ifndef CAN_CLOCK_H
+#define CAN_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+// 시스템 시계 (버스 타임스탬프, 시뮬레이터, 중앙 제어 장치가 사용)
+typedef enum
+{
+    CAN_CLOCK_REALTIME = 0, // CLOCK_MONOTONIC / time(NULL)
+    CAN_CLOCK_VIRTUAL = 1   // 이산 사건 모드: 시계를 모는 스레드가 다음 사건 시각으로 바로 옮김
+} can_clock_mode_t;
+
+// function
+void can_clock_use_realtime(void);
+void can_clock_use_virtual(uint64_t start_ns, time_t start_wall);
+can_clock_mode_t can_clock_mode(void);
+bool can_clock_is_virtual(void);
+uint64_t can_clock_now_ns(void);
+time_t can_clock_wall_time(void);
+uint64_t can_clock_wall_ns(void);
+bool can_clock_advance_to(uint64_t now_ns);
+void can_clock_sleep_until_ns(uint64_t deadline_ns);
+#endif
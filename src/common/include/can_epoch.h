@@ -0,0 +1,15 @@
+#ifndef CAN_EPOCH_H
+#define CAN_EPOCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 송수신 경로가 잠금 없이 읽는 객체(필터 뱅크, 구독자 목록)의 지연 해제 (epoch 기반)
+// 읽는 쪽은 can_epoch_enter/exit 사이에서만 포인터를 사용하고,
+// 교체한 쪽은 can_epoch_retire 로 넘기면 그 시점에 읽고 있던 스레드가 모두 빠져나간 뒤 free() 로 해제
+void can_epoch_enter(void);
+void can_epoch_exit(void);
+void can_epoch_retire(void *ptr);
+void can_epoch_drain(void);
+uint32_t can_epoch_pending(void);
+#endif
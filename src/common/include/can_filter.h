@@ -0,0 +1,78 @@
+#ifndef CAN_FILTER_H
+#define CAN_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CAN_FILTER_MAX_RULES 32
+#define CAN_STD_ID_COUNT 2048      // 11비트 표준 ID 공간
+#define CAN_STD_ID_MASK 0x7FFu
+#define CAN_EXT_ID_MASK 0x1FFFFFFFu // 29비트 확장 ID 공간
+
+// 필터 규칙 종류
+typedef enum
+{
+    CAN_FILTER_RULE_MASK = 0,  // (id & mask) == (rule.id & mask)
+    CAN_FILTER_RULE_RANGE = 1  // first <= id <= last
+} can_filter_rule_type_t;
+
+// 필터 규칙
+typedef struct
+{
+    can_filter_rule_type_t type;
+    bool is_extended; // 확장 프레임용 규칙 여부
+    uint32_t id;      // MASK: 필터 id, RANGE: 시작 id
+    uint32_t mask;    // MASK: 필터 마스크, RANGE: 끝 id (포함)
+} can_filter_rule_t;
+
+// 확장 ID 범위 (정렬 및 병합된 상태로 저장)
+typedef struct
+{
+    uint32_t first;
+    uint32_t last;
+} can_filter_range_t;
+
+// 확장 ID 마스크 (범위로 바꿀 수 없는 규칙)
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+} can_filter_mask_t;
+
+// 컴파일된 필터 뱅크
+typedef struct can_filter_bank
+{
+    uint64_t std_bitmap[CAN_STD_ID_COUNT / 64]; // 표준 ID 허용 비트맵
+    uint32_t ext_range_cnt;
+    can_filter_range_t ext_ranges[CAN_FILTER_MAX_RULES];
+    uint32_t ext_mask_cnt;
+    can_filter_mask_t ext_masks[CAN_FILTER_MAX_RULES];
+} can_filter_bank_t;
+
+static inline can_filter_rule_t can_filter_mask_rule(uint32_t id, uint32_t mask, bool is_extended)
+{
+    can_filter_rule_t rule = {CAN_FILTER_RULE_MASK, is_extended, id, mask};
+    return rule;
+}
+
+static inline can_filter_rule_t can_filter_range_rule(uint32_t first, uint32_t last, bool is_extended)
+{
+    can_filter_rule_t rule = {CAN_FILTER_RULE_RANGE, is_extended, first, last};
+    return rule;
+}
+
+// function
+bool can_filter_compile(can_filter_bank_t *bank, const can_filter_rule_t *rules, int rule_cnt);
+bool can_filter_accept_extended(const can_filter_bank_t *bank, uint32_t id);
+
+// 표준 ID 는 비트맵 한 번 조회로 판정
+static inline bool can_filter_bank_accept(const can_filter_bank_t *bank, uint32_t id, bool is_extended)
+{
+    if (!is_extended && id < CAN_STD_ID_COUNT)
+    {
+        return (bank->std_bitmap[id >> 6] >> (id & 63)) & 1;
+    }
+
+    return can_filter_accept_extended(bank, id & CAN_EXT_ID_MASK);
+}
+#endif
@@ -7,10 +7,13 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdatomic.h>
+#include "can_filter.h"
+#include "can_metrics.h"
 
 #define CAN_MAX_DATA_LENGTH 8
-#define CAN_MAX_INTERFACES 10
-#define CAN_MESSAGE_QUEUE_SIZE 1000
+#define CAN_DEFAULT_QUEUE_CAPACITY 1024 // 기본 큐 용량 (2의 거듭제곱으로 올림)
+#define CAN_LATENCY_BUCKETS 64          // 지연 히스토그램 구간 수 (log2 ns)
 
 // CAN message struct
 typedef struct
@@ -20,22 +23,32 @@ typedef struct
     uint8_t data[CAN_MAX_DATA_LENGTH]; // 데이터 바이트
     bool is_extended;                  // 확장 프레임 여부
     bool is_remote;                    // RTR 여부
-    // SYSTEMTIME timestamp;              // timestamp
+    uint64_t timestamp_ns;             // 송신 시각 (can_clock 기준 ns, can_send 에서 기록)
 } can_frame_t;
 
-// CAN interface struct
+// 송신-수신 지연 히스토그램 (buckets[i]: 2^i ~ 2^(i+1) ns, buckets[0]: 0 ~ 2 ns)
+typedef struct
+{
+    uint64_t count;
+    uint64_t buckets[CAN_LATENCY_BUCKETS];
+} can_latency_hist_t;
+
+// 메시지 큐 (락프리 링 버퍼, can_ring.h)
+typedef struct can_ring can_ring_t;
+
+// 캡처 기록기 (can_capture.h)
+typedef struct can_capture can_capture_t;
+
+// 인터페이스 핸들 (상위 16비트: 세대, 하위 16비트: 슬롯 번호)
+typedef uint32_t can_handle_t;
+#define CAN_INVALID_HANDLE 0u
+
+// CAN interface struct (관리자가 소유한 인터페이스를 가리키는 핸들, 복사해도 같은 인터페이스)
 typedef struct
 {
     char interface_name[32]; // 인터페이스 이름
     uint32_t node_id;        // node ID
-    bool is_connected;       // 연결 상태
-    uint32_t tx_cnt;         // 전송 메시지 카운터
-    uint32_t rx_cnt;         // 수신 메시지 카운터
-    uint32_t err_cnt;        // 에러 카운터
-
-    uint32_t filter_mask; // 필터 마스크
-    uint32_t filter_id;   // 필터 id
-    bool filter_enabled;  // 필터 사용 여부
+    can_handle_t handle;     // 관리자 핸들 (해제되면 모든 호출이 실패)
 } can_interface_t;
 
 // CAN error code
@@ -51,31 +64,64 @@ typedef enum
     CAN_ERROR_INIT_FAILED = -7
 } can_error_t;
 
-// 전역 메시지 큐 (단순한 링 버퍼)
+// 송수신 구현 (can_backend.h)
+typedef enum
+{
+    CAN_BACKEND_MEMORY = 0, // 프로세스 내부 버스 (can_bus.h)
+    CAN_BACKEND_SOCKETCAN,  // Linux SocketCAN 장치 (vcan0, can0 ...)
+    CAN_BACKEND_SHM         // 프로세스 간 공유 메모리 버스 (can_shm.h, device: "/이름" 또는 "fd:<n>")
+} can_backend_type_t;
+
+// 인터페이스 생성 설정
 typedef struct
 {
-    can_frame_t messages[CAN_MESSAGE_QUEUE_SIZE];
-    int head; // 쓰기 위치
-    int tail; // 읽기 위치
-    int cnt;  // 현재 메시지 수
-} can_message_queue_t;
+    uint32_t bus_id;            // 메모리 백엔드가 사용할 버스 (0이면 기본 버스)
+    can_backend_type_t backend;
+    const char *device;         // SocketCAN 장치 또는 공유 메모리 이름 (NULL 이면 인터페이스 이름)
+} can_interface_config_t;
 
-// CAN 인터페이스 관리자
+// CAN 관리자 설정
 typedef struct
 {
-    can_interface_t interfaces[CAN_MAX_INTERFACES];
-    int interface_cnt;
-    can_message_queue_t global_queue;
     bool debug_mode;
+    uint32_t queue_capacity; // 인터페이스별 수신 큐 용량 (0이면 기본값)
+} can_manager_config_t;
+
+// CAN 인터페이스 관리자 (인터페이스 본체는 can_registry 가 소유)
+typedef struct
+{
+    uint32_t queue_capacity;
+    bool debug_mode;
+
+    _Atomic(can_capture_t *) capture; // 송신 메시지 캡처 (NULL: 미사용)
+    atomic_int capture_users;         // 캡처에 기록 중인 송신 스레드 수
 } can_manager_t;
 
 // function
 can_error_t can_init_manager(bool debug_mode);
+can_error_t can_init_manager_ex(const can_manager_config_t *config);
 can_error_t can_create_interface(can_interface_t *can_interface, const char *name, uint32_t node_id);
+can_error_t can_create_interface_on_bus(can_interface_t *can_interface, const char *name, uint32_t node_id, uint32_t bus_id);
+can_error_t can_create_interface_ex(can_interface_t *can_interface, const char *name, uint32_t node_id, const can_interface_config_t *config);
+can_error_t can_destroy_interface(can_interface_t *can_interface);
+can_error_t can_find_interface(const char *name, can_interface_t *can_interface);
+can_error_t can_attach_interface(can_handle_t handle, can_interface_t *can_interface);
+bool can_is_connected(const can_interface_t *can_interface);
+int can_interface_count(void);
 can_error_t can_connect(can_interface_t *can_interface);
 can_error_t can_disconnect(can_interface_t *can_interface);
 can_error_t can_send(can_interface_t *can_interface, const can_frame_t *frame);
 can_error_t can_receive(can_interface_t *can_interface, can_frame_t *frame, int timeout_ms);
+int can_send_batch(can_interface_t *can_interface, const can_frame_t *frames, int n);
+int can_receive_batch(can_interface_t *can_interface, can_frame_t *frames, int max, int timeout_ms);
+int can_get_event_fd(can_interface_t *can_interface);
 can_error_t can_set_filter(can_interface_t *can_interface, uint32_t id, uint32_t mask);
+can_error_t can_set_filter_bank(can_interface_t *can_interface, const can_filter_rule_t *rules, int rule_cnt);
+can_error_t can_clear_filter(can_interface_t *can_interface);
+can_error_t can_get_latency_histogram(const can_interface_t *can_interface, can_latency_hist_t *hist);
+uint64_t can_latency_percentile(const can_latency_hist_t *hist, double percentile);
+void can_print_latency_report(void);
+can_error_t can_start_capture(const char *path);
+void can_stop_capture(void);
 void can_cleanup_manager(void);
 #endif
\ No newline at end of file
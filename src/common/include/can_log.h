@@ -0,0 +1,71 @@
+#ifndef CAN_LOG_H
+#define CAN_LOG_H
+
+#include "can_interface.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+#define CAN_LOG_RING_SIZE 4096 // 스레드별 로그 링 크기 (레코드 수, 2의 거듭제곱)
+#define CAN_LOG_MAX_ARGS 4
+#define CAN_LOG_NAME_LEN 32   // 레코드에 복사하는 인터페이스 이름 길이 (can_endpoint_t.interface_name 과 같음)
+#define CAN_LOG_IDLE_MS 1      // 포맷 스레드가 비었을 때 쉬는 시간
+
+// 로그 분류
+typedef enum
+{
+    CAN_LOG_CAT_BUS = 0,  // 인터페이스/관리자 이벤트
+    CAN_LOG_CAT_FRAME,    // 송수신 메시지 추적
+    CAN_LOG_CAT_CENTRAL,  // 중앙 제어기
+    CAN_LOG_CAT_SENSOR,   // 센서 노드
+    CAN_LOG_CAT_COUNT
+} can_log_category_t;
+
+// 로그 레벨 (설정값 이하만 기록)
+typedef enum
+{
+    CAN_LOG_OFF = 0,
+    CAN_LOG_ERROR,
+    CAN_LOG_WARN,
+    CAN_LOG_INFO,
+    CAN_LOG_DEBUG,
+    CAN_LOG_TRACE
+} can_log_level_t;
+
+// 레코드 종류 (포맷 스레드에서 출력 형식 결정)
+typedef enum
+{
+    CAN_LOG_FMT_MESSAGE = 0, // text 를 printf 형식으로, args 를 unsigned long long 인자로 사용
+    CAN_LOG_FMT_FRAME        // text: 방향, name: 인터페이스 이름, args: id, dlc|flags, data, timestamp
+} can_log_format_t;
+
+// 바이너리 로그 레코드 (포맷하지 않고 인자만 저장, 88 bytes)
+typedef struct
+{
+    uint64_t timestamp_ns;
+    uint8_t format;
+    uint8_t category;
+    uint8_t level;
+    uint8_t reserved[5];
+    const char *text; // 문자열 리터럴 등 수명이 긴 문자열만 사용
+    uint64_t args[CAN_LOG_MAX_ARGS];
+    char name[CAN_LOG_NAME_LEN]; // 출력 전에 인터페이스가 해제되거나 슬롯이 재사용될 수 있으므로 복사해 둠
+} can_log_record_t;
+
+// 분류별 레벨 (can_log_enabled 에서 바로 확인)
+extern _Atomic uint8_t g_can_log_levels[CAN_LOG_CAT_COUNT];
+
+static inline bool can_log_enabled(can_log_category_t category, can_log_level_t level)
+{
+    return level <= atomic_load_explicit(&g_can_log_levels[category], memory_order_relaxed);
+}
+
+// function
+void can_log_set_level(can_log_category_t category, can_log_level_t level);
+bool can_log_start(FILE *out);
+void can_log_stop(void);
+uint64_t can_log_dropped(void);
+void can_log_write(can_log_category_t category, can_log_level_t level, const char *text, uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3);
+void can_log_frame(can_log_category_t category, can_log_level_t level, const char *direction, const char *name, const can_frame_t *frame);
+#endif
@@ -0,0 +1,110 @@
+#ifndef CAN_METRICS_H
+#define CAN_METRICS_H
+
+#include "can_filter.h"
+#include "can_platform.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+#define CAN_METRICS_SHARDS 8                          // 카운터 샤드 수 (스레드마다 하나를 골라 사용)
+#define CAN_METRICS_ID_SLOTS (CAN_STD_ID_COUNT + 1)   // 표준 ID 별 + 확장 ID 전체
+#define CAN_METRICS_EXT_SLOT CAN_STD_ID_COUNT
+#define CAN_METRICS_UNIX_PREFIX "unix:"              // can_metrics_dump 대상이 Unix 소켓일 때의 접두어
+
+// 인터페이스별 카운터 종류
+typedef enum
+{
+    CAN_METRIC_TX_FRAMES = 0,   // 버스에 올라간 메시지
+    CAN_METRIC_TX_ERRORS,       // 송신 실패 (어느 수신 큐에도 들어가지 못함)
+    CAN_METRIC_RX_FRAMES,       // 수신한 메시지
+    CAN_METRIC_QUEUE_FULL_DROPS, // 수신 큐가 가득 차 버려진 메시지
+    CAN_METRIC_FILTER_REJECTS,  // 필터에 걸러진 메시지
+    CAN_METRIC_COUNT
+} can_metric_t;
+
+// 샤드 하나 (캐시 라인 단위로 분리하여 스레드 간 경합 방지)
+typedef struct
+{
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t value[CAN_METRIC_COUNT];
+} can_metrics_shard_t;
+
+// 인터페이스별 카운터 (읽을 때 샤드를 합산)
+typedef struct
+{
+    can_metrics_shard_t shards[CAN_METRICS_SHARDS];
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint32_t queue_high_water; // 수신 큐 최대 적재 수
+} can_iface_metrics_t;
+
+// 인터페이스 스냅샷
+typedef struct
+{
+    char name[32];
+    uint32_t node_id;
+    bool is_connected;
+    uint64_t counters[CAN_METRIC_COUNT];
+    uint32_t queue_depth;
+    uint32_t queue_high_water;
+    uint64_t latency_cnt;
+    uint64_t latency_p50_ns;
+    uint64_t latency_p99_ns;
+    uint64_t latency_p999_ns;
+} can_iface_snapshot_t;
+
+// 전체 스냅샷 (can_metrics_snapshot 으로 할당, can_metrics_free_snapshot 으로 해제)
+typedef struct
+{
+    uint64_t timestamp_ns;
+    int interface_cnt;
+    can_iface_snapshot_t *interfaces;
+    uint64_t frames_by_id[CAN_METRICS_ID_SLOTS]; // 송신된 메시지 수 (ID 별)
+} can_metrics_snapshot_t;
+
+// ID 별 송신 메시지 수 (샤드마다 한 줄)
+extern _Atomic uint64_t g_can_id_frames[CAN_METRICS_SHARDS][CAN_METRICS_ID_SLOTS];
+
+// 호출 스레드의 샤드 번호 (처음 호출 시 순서대로 배정)
+extern _Thread_local uint32_t t_can_metrics_shard;
+uint32_t can_metrics_assign_shard(void);
+
+static inline uint32_t can_metrics_shard(void)
+{
+    uint32_t shard = t_can_metrics_shard;
+    return shard ? shard - 1 : can_metrics_assign_shard();
+}
+
+static inline void can_metrics_add(can_iface_metrics_t *metrics, can_metric_t metric, uint64_t value)
+{
+    if (value == 0)
+    {
+        return;
+    }
+
+    atomic_fetch_add_explicit(&metrics->shards[can_metrics_shard()].value[metric], value, memory_order_relaxed);
+}
+
+static inline void can_metrics_update_high_water(can_iface_metrics_t *metrics, uint32_t depth)
+{
+    uint32_t current = atomic_load_explicit(&metrics->queue_high_water, memory_order_relaxed);
+    while (depth > current &&
+           !atomic_compare_exchange_weak_explicit(&metrics->queue_high_water, &current, depth, memory_order_relaxed, memory_order_relaxed))
+    {
+    }
+}
+
+static inline void can_metrics_count_id(uint32_t id, bool is_extended)
+{
+    uint32_t slot = is_extended ? CAN_METRICS_EXT_SLOT : (id & CAN_STD_ID_MASK);
+    atomic_fetch_add_explicit(&g_can_id_frames[can_metrics_shard()][slot], 1, memory_order_relaxed);
+}
+
+// function
+void can_metrics_reset(can_iface_metrics_t *metrics);
+uint64_t can_metrics_read(const can_iface_metrics_t *metrics, can_metric_t metric);
+can_metrics_snapshot_t *can_metrics_snapshot(void);
+void can_metrics_free_snapshot(can_metrics_snapshot_t *snapshot);
+double can_metrics_id_rate(const can_metrics_snapshot_t *prev, const can_metrics_snapshot_t *cur, uint32_t slot);
+void can_metrics_write_prometheus(FILE *out, const can_metrics_snapshot_t *snapshot);
+bool can_metrics_dump(const char *target);
+#endif
@@ -0,0 +1,67 @@
+#ifndef CAN_PLATFORM_H
+#define CAN_PLATFORM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#define CAN_CACHELINE_SIZE 64
+#define CAN_DEADLINE_NONE UINT64_MAX // 무기한 대기
+
+// CLOCK_MONOTONIC 기준 현재 시각 (ns)
+uint64_t can_monotonic_ns(void);
+
+// CLOCK_MONOTONIC 기준 deadline_ns 까지 대기
+void can_sleep_until_ns(uint64_t deadline_ns);
+
+// *addr 가 expected 인 동안 대기 (deadline_ns 경과 시 false)
+bool can_futex_wait(_Atomic uint32_t *addr, uint32_t expected, uint64_t deadline_ns, bool shared);
+void can_futex_wake_all(_Atomic uint32_t *addr, bool shared);
+
+// 캐시 라인 정렬 메모리 할당
+static inline void *can_aligned_alloc(size_t alignment, size_t size)
+{
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment, size) != 0)
+    {
+        return NULL;
+    }
+    return ptr;
+#endif
+}
+
+static inline void can_aligned_free(void *ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+// 2의 거듭제곱으로 올림 (0 -> 1)
+static inline uint32_t can_next_pow2(uint32_t value)
+{
+    if (value <= 1)
+    {
+        return 1;
+    }
+
+    value--;
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    return value + 1;
+}
+#endif
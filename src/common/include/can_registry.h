@@ -0,0 +1,101 @@
+#ifndef CAN_REGISTRY_H
+#define CAN_REGISTRY_H
+
+#include "can_interface.h"
+#include "can_platform.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define CAN_REGISTRY_PAGE_SHIFT 6
+#define CAN_REGISTRY_PAGE_SIZE (1u << CAN_REGISTRY_PAGE_SHIFT) // 페이지당 엔드포인트 수
+#define CAN_REGISTRY_MAX_PAGES 1024                             // 최대 65536 개
+#define CAN_HANDLE_INDEX_BITS 16
+#define CAN_HANDLE_INDEX_MASK ((1u << CAN_HANDLE_INDEX_BITS) - 1)
+#define CAN_REGISTRY_NIL UINT32_MAX
+#define CAN_MAX_BUSES 16
+#define CAN_DEVICE_NAME_LEN 64 // SocketCAN 장치 (IFNAMSIZ) 또는 공유 메모리 이름
+
+struct can_backend;
+
+// 관리자가 소유하는 인터페이스 본체 (슬롯은 해제하지 않고 재사용)
+typedef struct can_endpoint
+{
+    _Atomic can_handle_t handle; // 현재 핸들 (CAN_INVALID_HANDLE: 빈 슬롯)
+    uint32_t index;              // 슬롯 번호 (핸들 하위 16비트)
+    uint16_t generation;         // 슬롯을 재사용할 때마다 증가
+
+    char interface_name[32];
+    uint32_t node_id;
+    uint32_t bus_id; // 소속 버스 (can_bus.h)
+    atomic_bool is_connected;
+
+    const struct can_backend *backend; // 송수신 구현 (can_backend.h)
+    char device[CAN_DEVICE_NAME_LEN];  // SocketCAN 장치 이름
+    atomic_int sock_fd;                // SocketCAN 소켓 (-1: 열리지 않음)
+    void *backend_ctx;                 // 백엔드가 연결 중에 사용하는 상태 (공유 메모리 매핑 등)
+
+    _Atomic(can_filter_bank_t *) filter; // 컴파일된 필터 뱅크 (NULL: 모두 수신, 교체된 뱅크는 can_epoch 로 해제)
+
+    can_ring_t *rx_queue; // 수신 큐 (슬롯과 함께 재사용)
+    can_ring_t *tx_queue; // 워커가 있는 버스에서만 사용하는 송신 큐 (워커가 꺼내 배달)
+
+    atomic_int event_fd;       // 수신 알림용 eventfd (-1: 미사용)
+    atomic_bool event_pending; // eventfd 에 신호가 남아있는지 여부
+
+    _Atomic uint64_t latency_hist[CAN_LATENCY_BUCKETS]; // 수신 시점에 기록하는 송신-수신 지연
+    can_iface_metrics_t metrics;                        // 송수신/에러 카운터 (can_metrics.h)
+
+    uint32_t next_free;    // 빈 슬롯 목록
+    uint32_t next_by_name; // 이름 해시 체인
+} can_endpoint_t;
+
+// 송신 시 순회하는 엔드포인트 목록 (전체 및 버스별, 등록/해제 시 새로 만들어 교체, 이전 목록은 can_epoch 로 해제)
+typedef struct can_subscribers
+{
+    int cnt;
+    can_endpoint_t *endpoints[];
+} can_subscribers_t;
+
+// 지연 히스토그램 읽기
+static inline void can_endpoint_latency(const can_endpoint_t *endpoint, can_latency_hist_t *hist)
+{
+    hist->count = 0;
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; i++)
+    {
+        hist->buckets[i] = atomic_load_explicit(&endpoint->latency_hist[i], memory_order_relaxed);
+        hist->count += hist->buckets[i];
+    }
+}
+
+// function
+bool can_registry_init(uint32_t queue_capacity);
+void can_registry_cleanup(void);
+can_endpoint_t *can_registry_open(const char *name, uint32_t node_id, uint32_t bus_id, bool with_tx_queue,
+                                  const struct can_backend *backend);
+bool can_registry_close(can_handle_t handle);
+can_handle_t can_registry_find(const char *name);
+const can_subscribers_t *can_registry_subscribers(void);
+const can_subscribers_t *can_registry_bus_subscribers(uint32_t bus_id);
+
+// 핸들로 엔드포인트 조회 (빈 슬롯이거나 세대가 다르면 NULL)
+extern _Atomic(can_endpoint_t *) g_can_registry_pages[CAN_REGISTRY_MAX_PAGES];
+
+static inline can_endpoint_t *can_registry_get(can_handle_t handle)
+{
+    uint32_t index = handle & CAN_HANDLE_INDEX_MASK;
+    if (handle == CAN_INVALID_HANDLE || (index >> CAN_REGISTRY_PAGE_SHIFT) >= CAN_REGISTRY_MAX_PAGES)
+    {
+        return NULL;
+    }
+
+    can_endpoint_t *page = atomic_load_explicit(&g_can_registry_pages[index >> CAN_REGISTRY_PAGE_SHIFT], memory_order_acquire);
+    if (!page)
+    {
+        return NULL;
+    }
+
+    can_endpoint_t *endpoint = &page[index & (CAN_REGISTRY_PAGE_SIZE - 1)];
+    return atomic_load_explicit(&endpoint->handle, memory_order_acquire) == handle ? endpoint : NULL;
+}
+#endif
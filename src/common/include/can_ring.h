@@ -0,0 +1,40 @@
+#ifndef CAN_RING_H
+#define CAN_RING_H
+
+#include "can_interface.h"
+#include "can_platform.h"
+#include <stdatomic.h>
+
+// 락프리 MPMC 링 버퍼 (슬롯별 시퀀스 번호 방식)
+typedef struct
+{
+    _Atomic uint64_t sequence; // 슬롯 상태 (pos: 비어있음, pos+1: 데이터 있음)
+    can_frame_t frame;
+} can_ring_slot_t;
+
+struct can_ring
+{
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t head;  // 쓰기 위치 (생산자)
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t tail;  // 읽기 위치 (소비자)
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint32_t epoch; // 대기자 깨우기용 futex 워드
+    _Atomic uint32_t waiters;                            // 대기 중인 소비자 수
+    _Alignas(CAN_CACHELINE_SIZE) uint32_t capacity;      // 슬롯 수 (2의 거듭제곱)
+    uint32_t mask;
+    bool process_shared; // 공유 메모리에 놓인 링 (프로세스 간 futex 사용)
+    can_ring_slot_t slots[];
+};
+
+// 링은 포인터를 담지 않으므로 공유 메모리에 그대로 둘 수 있음 (can_ring_bytes 크기의 캐시 라인 정렬 영역)
+// function
+size_t can_ring_bytes(uint32_t capacity);
+can_ring_t *can_ring_init(void *memory, uint32_t capacity, bool process_shared);
+can_ring_t *can_ring_create(uint32_t capacity);
+void can_ring_destroy(can_ring_t *ring);
+bool can_ring_push(can_ring_t *ring, const can_frame_t *frame);
+bool can_ring_pop(can_ring_t *ring, can_frame_t *frame);
+uint32_t can_ring_push_batch(can_ring_t *ring, const can_frame_t *frames, uint32_t n);
+uint32_t can_ring_pop_batch(can_ring_t *ring, can_frame_t *frames, uint32_t max);
+uint32_t can_ring_size(const can_ring_t *ring);
+bool can_ring_wait(can_ring_t *ring, uint64_t deadline_ns);
+void can_ring_wake(can_ring_t *ring);
+#endif
@@ -0,0 +1,61 @@
+#ifndef CAN_SHM_H
+#define CAN_SHM_H
+
+#include "can_interface.h"
+#include "can_filter.h"
+#include "can_platform.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define CAN_SHM_MAGIC 0x4D485343u // "CSHM"
+#define CAN_SHM_VERSION 3
+#define CAN_SHM_SLOTS 32            // 한 영역에 붙을 수 있는 인터페이스 수
+#define CAN_SHM_POLL_SLICE_MS 100   // 블로킹 수신 중 연결 상태를 다시 확인하는 주기
+#define CAN_SHM_ATTACH_TIMEOUT_MS 1000 // 다른 프로세스가 영역을 초기화할 때까지 기다리는 시간
+#define CAN_SHM_FD_PREFIX "fd:"     // 장치 이름이 "fd:<n>" 이면 상속받은 memfd 사용
+#define CAN_SHM_FILTER_SPIN 1024    // 필터가 갱신 중이면 이만큼 다시 읽은 뒤 소유 프로세스가 살아있는지 확인
+#define CAN_SHM_DRAIN_SPIN 1024     // 적재 중인 송신측을 기다리며 이만큼 다시 읽은 뒤 송신 프로세스가 살아있는지 확인
+
+// 슬롯 상태
+typedef enum
+{
+    CAN_SHM_SLOT_FREE = 0,
+    CAN_SHM_SLOT_CLAIMED, // 초기화 또는 회수 중 (송신 대상 아님)
+    CAN_SHM_SLOT_ACTIVE
+} can_shm_slot_state_t;
+
+// 영역 헤더 (영역 안에는 포인터를 두지 않고 오프셋만 사용)
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slot_cnt;
+    uint32_t ring_capacity;
+    uint64_t slot_stride; // 슬롯 하나 (헤더 + 수신 링) 의 바이트 수
+    uint64_t ring_offset; // 슬롯 시작에서 수신 링까지의 오프셋
+    _Atomic uint32_t ready; // 생성한 프로세스가 초기화를 마치면 1
+} can_shm_header_t;
+
+// 인터페이스 슬롯 (수신 링이 뒤따름)
+typedef struct
+{
+    _Atomic uint32_t state;     // can_shm_slot_state_t
+    _Atomic int32_t owner_pid;  // 소유 프로세스 (0: 빈 슬롯, 0 에서 자신의 pid 로 CAS 하는 것이 차지, 종료하면 회수)
+    uint32_t node_id;
+    char name[32];
+
+    // 필터는 소유 프로세스만 쓰고 송신측은 seqlock 으로 검증하며 읽음
+    _Atomic uint32_t filter_seq; // 홀수: 갱신 중 (갱신 중 종료한 슬롯은 차지할 때 다시 짝수로)
+    bool filter_enabled;
+    can_filter_bank_t filter;
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t queue_full_drops;
+
+    // senders[j]: 슬롯 j 의 송신측이 이 슬롯 수신 링에 적재 중인 수 (차지할 때 0 이 된 뒤에 링을 다시 구성)
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint32_t senders[CAN_SHM_SLOTS];
+} can_shm_slot_t;
+
+// function
+int can_shm_create_memfd(const char *name, uint32_t ring_capacity);
+#endif
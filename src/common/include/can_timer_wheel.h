@@ -0,0 +1,41 @@
+#ifndef CAN_TIMER_WHEEL_H
+#define CAN_TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CAN_TIMER_WHEEL_LEVELS 4
+#define CAN_TIMER_WHEEL_BITS 8
+#define CAN_TIMER_WHEEL_SLOTS (1u << CAN_TIMER_WHEEL_BITS) // 단계별 슬롯 수 (단계 L 의 슬롯 폭: 256^L 틱)
+#define CAN_TIMER_NONE UINT32_MAX
+#define CAN_TIMER_TICK_NONE UINT64_MAX
+
+// 만료된 타이머 콜백 (콜백 안에서 같은 타이머를 다시 걸 수 있음)
+typedef void (*can_timer_fn_t)(void *ctx, uint32_t timer_id, uint64_t expiry_tick);
+
+// 계층형 타이머 휠 (타이머는 0 ~ capacity-1 번호로 식별, 타이머별 연결 정보는 배열로 보관)
+// 단일 스레드 전용
+typedef struct
+{
+    uint32_t capacity;
+    uint32_t armed_cnt;
+    uint64_t now_tick; // 마지막으로 처리한 틱
+
+    uint64_t *expiry; // 타이머별 만료 틱
+    uint32_t *next;
+    uint32_t *prev;
+    uint32_t *bucket; // 타이머가 걸린 슬롯 (CAN_TIMER_NONE: 걸리지 않음)
+
+    uint32_t heads[CAN_TIMER_WHEEL_LEVELS * CAN_TIMER_WHEEL_SLOTS];
+    uint64_t occupied[CAN_TIMER_WHEEL_LEVELS * CAN_TIMER_WHEEL_SLOTS / 64]; // 비어 있지 않은 슬롯 비트맵 (빈 틱 건너뛰기용)
+} can_timer_wheel_t;
+
+// function
+bool can_timer_wheel_init(can_timer_wheel_t *wheel, uint32_t capacity, uint64_t start_tick);
+void can_timer_wheel_free(can_timer_wheel_t *wheel);
+void can_timer_wheel_arm(can_timer_wheel_t *wheel, uint32_t timer_id, uint64_t expiry_tick);
+void can_timer_wheel_cancel(can_timer_wheel_t *wheel, uint32_t timer_id);
+bool can_timer_wheel_is_armed(const can_timer_wheel_t *wheel, uint32_t timer_id);
+uint64_t can_timer_wheel_next_tick(const can_timer_wheel_t *wheel);
+uint32_t can_timer_wheel_advance(can_timer_wheel_t *wheel, uint64_t now_tick, can_timer_fn_t fn, void *ctx);
+#endif
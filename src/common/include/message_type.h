@@ -8,6 +8,10 @@
 #define CAN_ID_PRESSURE_BASE 0X200
 #define CAN_ID_VIBRATION_BASE 0X300
 #define CAN_ID_SYSTEM_BASE 0X400
+#define CAN_ID_SYSTEM_END 0X500
+
+// 센서값 스케일 (전송값 = 실제값 * 100, int16)
+#define SENSOR_VALUE_SCALE 100
 
 // 메시지 타입
 typedef enum
@@ -72,4 +76,25 @@ typedef enum
     SENSOR_ERROR = 0x02,
     SENSOR_OFFLINE = 0x03
 } sensor_status_t;
+
+// 실제값 -> 전송값 (반올림, int16 범위로 포화)
+static inline int16_t sensor_value_to_raw(float value)
+{
+    float scaled = value * SENSOR_VALUE_SCALE;
+    if (scaled >= 32767.0f)
+    {
+        return INT16_MAX;
+    }
+    if (scaled <= -32768.0f)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+// 전송값 -> 실제값
+static inline float sensor_raw_to_value(int16_t raw)
+{
+    return (float)raw / SENSOR_VALUE_SCALE;
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef SENSOR_ENGINE_H
+#define SENSOR_ENGINE_H
+
+#include "sensor_common.h"
+#include "sensor_waveform.h"
+#include "../../common/include/can_timer_wheel.h"
+#include "../../common/include/can_platform.h"
+#include "../../common/include/can_clock.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define SENSOR_ENGINE_MAX_WORKERS 16
+#define SENSOR_ENGINE_TICK_MS 1      // 타이머 휠 틱 (ms)
+#define SENSOR_ENGINE_SEND_BATCH 256 // can_send_batch 한 번에 보내는 메시지 수
+#define SENSOR_ENGINE_MAX_IDS 256    // 메시지의 sensor_id 가 uint8 이므로 버스 하나에서 구분되는 센서 수
+
+// 센서별 타이머 (타이머 번호 = 워커 내 센서 순번 * 2 + 종류)
+typedef enum
+{
+    SENSOR_TIMER_SAMPLE = 0,
+    SENSOR_TIMER_HEARTBEAT = 1,
+    SENSOR_TIMER_KINDS = 2
+} sensor_timer_kind_t;
+
+// 시뮬레이터 엔진 설정
+typedef struct
+{
+    uint32_t capacity;              // 최대 센서 수
+    int worker_cnt;                 // 워커 스레드 수 (0이면 1)
+    uint32_t bus_id;                // 워커 인터페이스를 만들 버스
+    uint32_t sample_interval_ms;    // 0이면 SIMULATION_INVERVAL_MS
+    uint32_t heartbeat_interval_ms; // 0이면 HEARTBEAT_INTERVAL_MS
+    uint64_t seed;                  // 노이즈 난수 키 (같은 시드면 같은 노이즈)
+    bool allow_shared_ids;          // true: 같은 sensor_id 를 여러 센서가 공유 (부하 시험용, 수신측에서 구분되지 않음)
+} sensor_engine_config_t;
+
+typedef struct sensor_engine sensor_engine_t;
+
+// 워커 하나 (연속된 센서 구간과 자신의 타이머 휠, 송신 인터페이스를 소유)
+typedef struct
+{
+    sensor_engine_t *engine;
+    int index;
+    uint32_t first; // 담당 센서 [first, last)
+    uint32_t last;
+
+    can_timer_wheel_t wheel;
+    can_interface_t can_interface;
+    pthread_t thread;
+
+    sensor_wave_batch_t wave; // 이번 틱에 마감된 샘플
+    int batch_cnt;
+    can_frame_t batch[SENSOR_ENGINE_SEND_BATCH];
+
+    _Alignas(CAN_CACHELINE_SIZE) _Atomic uint64_t samples; // 워커만 갱신
+    _Atomic uint64_t heartbeats;
+    _Atomic uint64_t dropped; // 송신 큐가 가득 차 보내지 못한 메시지
+} sensor_engine_worker_t;
+
+// 센서 상태는 항목별 배열로 보관 (센서 순번으로 인덱싱)
+struct sensor_engine
+{
+    uint32_t capacity;
+    uint32_t sensor_cnt;
+    int worker_cnt;
+    uint32_t bus_id;
+    uint32_t sample_interval_ms;
+    uint32_t heartbeat_interval_ms;
+    uint64_t seed;
+    bool allow_shared_ids;
+    uint64_t id_used[SENSOR_ENGINE_MAX_IDS / 64]; // 등록된 sensor_id 비트맵
+
+    uint8_t *sensor_id;
+    uint8_t *type;
+    uint8_t *unit;
+    uint8_t *status;
+    uint16_t *sequence;
+    uint32_t *can_id;
+    float *base_value;
+    float *amplitude;
+    float *frequency;
+    float *noise_level;
+    float *drift_rate;
+    float *accumulated_drift;
+    float *current_value;
+
+    sensor_engine_worker_t *workers;
+    atomic_bool running;
+    bool stepped;      // 가상 시계: 워커 스레드 없이 sensor_engine_run_until 로 진행
+    uint64_t start_ns; // can_clock 기준 시작 시각 (틱 0)
+};
+
+// 엔진 통계
+typedef struct
+{
+    uint64_t samples;
+    uint64_t heartbeats;
+    uint64_t dropped;
+    uint32_t sensor_cnt;
+    int worker_cnt;
+} sensor_engine_stats_t;
+
+// function
+bool sensor_engine_init(sensor_engine_t *engine, const sensor_engine_config_t *config);
+void sensor_engine_free(sensor_engine_t *engine);
+int sensor_engine_add(sensor_engine_t *engine, uint8_t sensor_id, sensor_type_t type, uint32_t can_id, const sensor_sim_params_t *params);
+int sensor_engine_add_virtual(sensor_engine_t *engine, const virtual_sensor_t *sensor);
+can_error_t sensor_engine_start(sensor_engine_t *engine);
+void sensor_engine_stop(sensor_engine_t *engine);
+uint64_t sensor_engine_run_until(sensor_engine_t *engine, uint64_t end_ns);
+void sensor_engine_get_stats(const sensor_engine_t *engine, sensor_engine_stats_t *stats);
+#endif
@@ -0,0 +1,40 @@
+#ifndef SENSOR_WAVEFORM_H
+#define SENSOR_WAVEFORM_H
+
+#include "../../common/include/can_interface.h"
+#include <stdint.h>
+
+#define SENSOR_WAVE_BATCH 256 // 한 번에 계산하는 샘플 수
+
+struct sensor_engine;
+
+// 사용 중인 파형 커널 종류
+typedef enum
+{
+    SENSOR_WAVE_KERNEL_SCALAR = 0,
+    SENSOR_WAVE_KERNEL_AVX2 = 1
+} sensor_wave_kernel_t;
+
+// 마감된 센서 샘플 묶음 (워커가 모은 뒤 한 번에 계산, lane 배열은 작업 영역)
+typedef struct
+{
+    int cnt;
+    uint32_t index[SENSOR_WAVE_BATCH]; // 엔진 센서 순번
+    uint64_t tick[SENSOR_WAVE_BATCH];  // 샘플 시각 (엔진 틱)
+
+    float phase[SENSOR_WAVE_BATCH]; // 주기 내 위치 (0.0 ~ 1.0)
+    float base[SENSOR_WAVE_BATCH];
+    float amplitude[SENSOR_WAVE_BATCH];
+    float noise_level[SENSOR_WAVE_BATCH];
+    float drift[SENSOR_WAVE_BATCH];
+    float value[SENSOR_WAVE_BATCH];
+    uint32_t random[SENSOR_WAVE_BATCH];
+} sensor_wave_batch_t;
+
+// function
+void sensor_wave_philox(const uint32_t *counter_lo, const uint64_t *counter_hi, uint64_t seed, uint32_t *out, int n);
+void sensor_wave_sin_turns(const float *phase, float *out, int n);
+int sensor_wave_generate(struct sensor_engine *engine, sensor_wave_batch_t *batch, can_frame_t *frames);
+sensor_wave_kernel_t sensor_wave_kernel(void);
+void sensor_wave_force_kernel(sensor_wave_kernel_t kernel);
+#endif
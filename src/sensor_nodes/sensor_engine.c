@@ -0,0 +1,454 @@
+#include "include/sensor_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SENSOR_ENGINE_TICK_NS ((uint64_t)SENSOR_ENGINE_TICK_MS * 1000000ull)
+
+static void *sensor_engine_worker(void *arg);
+static void sensor_engine_on_timer(void *ctx, uint32_t timer_id, uint64_t expiry_tick);
+static void sensor_engine_flush_samples(sensor_engine_worker_t *worker);
+static void sensor_engine_emit_heartbeat(sensor_engine_worker_t *worker, uint32_t i, uint64_t tick);
+static can_frame_t *sensor_engine_next_frame(sensor_engine_worker_t *worker);
+static void sensor_engine_flush(sensor_engine_worker_t *worker);
+static void sensor_engine_counter_add(_Atomic uint64_t *counter, uint64_t n);
+static uint8_t sensor_engine_unit(sensor_type_t type);
+static void sensor_engine_close_workers(sensor_engine_t *engine, int worker_cnt);
+
+bool sensor_engine_init(sensor_engine_t *engine, const sensor_engine_config_t *config)
+{
+    if (!engine || !config || config->capacity == 0 || config->worker_cnt < 0 || config->worker_cnt > SENSOR_ENGINE_MAX_WORKERS)
+    {
+        return false;
+    }
+
+    memset(engine, 0, sizeof(sensor_engine_t));
+    engine->capacity = config->capacity;
+    engine->worker_cnt = config->worker_cnt ? config->worker_cnt : 1;
+    engine->bus_id = config->bus_id;
+    engine->sample_interval_ms = config->sample_interval_ms ? config->sample_interval_ms : SIMULATION_INVERVAL_MS;
+    engine->heartbeat_interval_ms = config->heartbeat_interval_ms ? config->heartbeat_interval_ms : HEARTBEAT_INTERVAL_MS;
+    engine->seed = config->seed;
+    engine->allow_shared_ids = config->allow_shared_ids;
+
+    uint32_t n = config->capacity;
+    engine->sensor_id = calloc(n, sizeof(uint8_t));
+    engine->type = calloc(n, sizeof(uint8_t));
+    engine->unit = calloc(n, sizeof(uint8_t));
+    engine->status = calloc(n, sizeof(uint8_t));
+    engine->sequence = calloc(n, sizeof(uint16_t));
+    engine->can_id = calloc(n, sizeof(uint32_t));
+    engine->base_value = calloc(n, sizeof(float));
+    engine->amplitude = calloc(n, sizeof(float));
+    engine->frequency = calloc(n, sizeof(float));
+    engine->noise_level = calloc(n, sizeof(float));
+    engine->drift_rate = calloc(n, sizeof(float));
+    engine->accumulated_drift = calloc(n, sizeof(float));
+    engine->current_value = calloc(n, sizeof(float));
+    engine->workers = can_aligned_alloc(CAN_CACHELINE_SIZE, sizeof(sensor_engine_worker_t) * SENSOR_ENGINE_MAX_WORKERS);
+
+    if (!engine->sensor_id || !engine->type || !engine->unit || !engine->status || !engine->sequence || !engine->can_id ||
+        !engine->base_value || !engine->amplitude || !engine->frequency || !engine->noise_level || !engine->drift_rate ||
+        !engine->accumulated_drift || !engine->current_value || !engine->workers)
+    {
+        sensor_engine_free(engine);
+        return false;
+    }
+
+    memset(engine->workers, 0, sizeof(sensor_engine_worker_t) * SENSOR_ENGINE_MAX_WORKERS);
+    atomic_init(&engine->running, false);
+    return true;
+}
+
+void sensor_engine_free(sensor_engine_t *engine)
+{
+    if (!engine)
+    {
+        return;
+    }
+
+    sensor_engine_stop(engine);
+
+    free(engine->sensor_id);
+    free(engine->type);
+    free(engine->unit);
+    free(engine->status);
+    free(engine->sequence);
+    free(engine->can_id);
+    free(engine->base_value);
+    free(engine->amplitude);
+    free(engine->frequency);
+    free(engine->noise_level);
+    free(engine->drift_rate);
+    free(engine->accumulated_drift);
+    free(engine->current_value);
+    can_aligned_free(engine->workers);
+    memset(engine, 0, sizeof(sensor_engine_t));
+}
+
+// 센서 추가 (시작 전에만 가능, 센서 순번 또는 음수 에러 코드 반환)
+// 데이터 메시지의 sensor_id 와 하트비트 ID (CAN_ID_SYSTEM_BASE + sensor_id) 가 센서를 구분하므로
+// 버스 하나에서 서로 다른 센서는 SENSOR_ENGINE_MAX_IDS 개까지 (allow_shared_ids 가 아니면 중복 sensor_id 는 거부)
+int sensor_engine_add(sensor_engine_t *engine, uint8_t sensor_id, sensor_type_t type, uint32_t can_id, const sensor_sim_params_t *params)
+{
+    if (!engine || !params || type > SENSOR_TYPE_VIBRATION)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    if (atomic_load(&engine->running) || engine->sensor_cnt >= engine->capacity)
+    {
+        return CAN_ERROR_QUEUE_FULL;
+    }
+
+    uint64_t id_bit = 1ull << (sensor_id & 63);
+    if (!engine->allow_shared_ids && (engine->id_used[sensor_id >> 6] & id_bit))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+    engine->id_used[sensor_id >> 6] |= id_bit;
+
+    uint32_t i = engine->sensor_cnt++;
+    engine->sensor_id[i] = sensor_id;
+    engine->type[i] = (uint8_t)type;
+    engine->unit[i] = sensor_engine_unit(type);
+    engine->status[i] = SENSOR_OK;
+    engine->sequence[i] = 0;
+    engine->can_id[i] = can_id;
+    engine->base_value[i] = params->base_value;
+    engine->amplitude[i] = params->amplitude;
+    engine->frequency[i] = params->frequency;
+    engine->noise_level[i] = params->noise_level;
+    engine->drift_rate[i] = params->drift_rate;
+    engine->accumulated_drift[i] = 0.0f;
+    engine->current_value[i] = params->base_value;
+
+    return (int)i;
+}
+
+// 기존 가상 센서 설정으로 추가 (데이터 ID: can_id_base + sensor_id)
+int sensor_engine_add_virtual(sensor_engine_t *engine, const virtual_sensor_t *sensor)
+{
+    if (!sensor)
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    return sensor_engine_add(engine, sensor->sensor_id, sensor->type, sensor->can_id_base + sensor->sensor_id, &sensor->params);
+}
+
+// 센서를 워커 수만큼 연속 구간으로 나누고 워커별 인터페이스와 스레드 생성 (가상 시계이면 스레드 없이 준비만)
+can_error_t sensor_engine_start(sensor_engine_t *engine)
+{
+    if (!engine || engine->sensor_cnt == 0 || atomic_load(&engine->running))
+    {
+        return CAN_ERROR_INVALID_PARAM;
+    }
+
+    int worker_cnt = engine->worker_cnt;
+    if ((uint32_t)worker_cnt > engine->sensor_cnt)
+    {
+        worker_cnt = (int)engine->sensor_cnt;
+    }
+
+    uint64_t sample_ticks = engine->sample_interval_ms / SENSOR_ENGINE_TICK_MS;
+    uint64_t heartbeat_ticks = engine->heartbeat_interval_ms / SENSOR_ENGINE_TICK_MS;
+
+    engine->start_ns = can_clock_now_ns();
+    engine->stepped = can_clock_is_virtual();
+    atomic_store(&engine->running, true);
+
+    for (int w = 0; w < worker_cnt; w++)
+    {
+        sensor_engine_worker_t *worker = &engine->workers[w];
+        memset(worker, 0, sizeof(sensor_engine_worker_t));
+        worker->engine = engine;
+        worker->index = w;
+        worker->first = (uint32_t)((uint64_t)engine->sensor_cnt * w / worker_cnt);
+        worker->last = (uint32_t)((uint64_t)engine->sensor_cnt * (w + 1) / worker_cnt);
+
+        char name[32];
+        snprintf(name, sizeof(name), "sim%u.%d", engine->bus_id, w);
+
+        if (!can_timer_wheel_init(&worker->wheel, (worker->last - worker->first) * SENSOR_TIMER_KINDS, 0))
+        {
+            sensor_engine_close_workers(engine, w);
+            return CAN_ERROR_INIT_FAILED;
+        }
+
+        // 송신 전용 인터페이스 (빈 필터 뱅크로 다른 워커의 메시지를 받지 않음)
+        if (can_create_interface_on_bus(&worker->can_interface, name, (uint32_t)w, engine->bus_id) != CAN_SUCCESS ||
+            can_connect(&worker->can_interface) != CAN_SUCCESS ||
+            can_set_filter_bank(&worker->can_interface, NULL, 0) != CAN_SUCCESS)
+        {
+            can_destroy_interface(&worker->can_interface);
+            can_timer_wheel_free(&worker->wheel);
+            sensor_engine_close_workers(engine, w);
+            return CAN_ERROR_INIT_FAILED;
+        }
+
+        // 첫 마감은 전체 센서에 고르게 흩어 한 틱에 몰리지 않게 함
+        for (uint32_t i = worker->first; i < worker->last; i++)
+        {
+            uint32_t timer_id = (i - worker->first) * SENSOR_TIMER_KINDS;
+            uint64_t sample_offset = sample_ticks * i / engine->sensor_cnt;
+            uint64_t heartbeat_offset = heartbeat_ticks * i / engine->sensor_cnt;
+            can_timer_wheel_arm(&worker->wheel, timer_id + SENSOR_TIMER_SAMPLE, sample_offset + 1);
+            can_timer_wheel_arm(&worker->wheel, timer_id + SENSOR_TIMER_HEARTBEAT, heartbeat_offset + 1);
+        }
+
+        if (!engine->stepped && pthread_create(&worker->thread, NULL, sensor_engine_worker, worker) != 0)
+        {
+            can_destroy_interface(&worker->can_interface);
+            can_timer_wheel_free(&worker->wheel);
+            sensor_engine_close_workers(engine, w);
+            return CAN_ERROR_INIT_FAILED;
+        }
+    }
+
+    engine->worker_cnt = worker_cnt;
+    printf("[SIM] Engine started: %u sensors, %d workers%s\n", engine->sensor_cnt, worker_cnt, engine->stepped ? " (virtual clock)" : "");
+    return CAN_SUCCESS;
+}
+
+void sensor_engine_stop(sensor_engine_t *engine)
+{
+    if (!engine || !atomic_load(&engine->running))
+    {
+        return;
+    }
+
+    sensor_engine_close_workers(engine, engine->worker_cnt);
+}
+
+// 가상 시계 모드: 가장 이른 마감 시각으로 시계를 옮겨 가며 end_ns 까지 진행 (처리한 마감 수 반환)
+// 호출한 스레드에서 워커 순서대로 처리하므로 같은 시드와 설정이면 항상 같은 메시지열을 만듦
+uint64_t sensor_engine_run_until(sensor_engine_t *engine, uint64_t end_ns)
+{
+    if (!engine || !engine->stepped || !atomic_load(&engine->running))
+    {
+        return 0;
+    }
+
+    uint64_t end_tick = end_ns > engine->start_ns ? (end_ns - engine->start_ns) / SENSOR_ENGINE_TICK_NS : 0;
+    uint64_t fired = 0;
+
+    while (true)
+    {
+        uint64_t tick = CAN_TIMER_TICK_NONE;
+        for (int w = 0; w < engine->worker_cnt; w++)
+        {
+            uint64_t next = can_timer_wheel_next_tick(&engine->workers[w].wheel);
+            tick = next < tick ? next : tick;
+        }
+
+        if (tick > end_tick)
+        {
+            break;
+        }
+
+        can_clock_advance_to(engine->start_ns + tick * SENSOR_ENGINE_TICK_NS);
+
+        for (int w = 0; w < engine->worker_cnt; w++)
+        {
+            sensor_engine_worker_t *worker = &engine->workers[w];
+            fired += can_timer_wheel_advance(&worker->wheel, tick, sensor_engine_on_timer, worker);
+            sensor_engine_flush_samples(worker);
+            sensor_engine_flush(worker);
+        }
+    }
+
+    can_clock_advance_to(end_ns);
+    return fired;
+}
+
+void sensor_engine_get_stats(const sensor_engine_t *engine, sensor_engine_stats_t *stats)
+{
+    if (!engine || !stats)
+    {
+        return;
+    }
+
+    memset(stats, 0, sizeof(sensor_engine_stats_t));
+    stats->sensor_cnt = engine->sensor_cnt;
+    stats->worker_cnt = engine->worker_cnt;
+
+    if (!engine->workers)
+    {
+        return;
+    }
+
+    for (int w = 0; w < engine->worker_cnt; w++)
+    {
+        const sensor_engine_worker_t *worker = &engine->workers[w];
+        stats->samples += atomic_load_explicit(&worker->samples, memory_order_relaxed);
+        stats->heartbeats += atomic_load_explicit(&worker->heartbeats, memory_order_relaxed);
+        stats->dropped += atomic_load_explicit(&worker->dropped, memory_order_relaxed);
+    }
+}
+
+// ------------- static method -------------
+// 틱마다 휠을 진행하고 만료된 센서의 메시지를 모아서 송신
+static void *sensor_engine_worker(void *arg)
+{
+    sensor_engine_worker_t *worker = (sensor_engine_worker_t *)arg;
+    sensor_engine_t *engine = worker->engine;
+
+    while (atomic_load_explicit(&engine->running, memory_order_acquire))
+    {
+        uint64_t tick = (can_clock_now_ns() - engine->start_ns) / SENSOR_ENGINE_TICK_NS;
+
+        can_timer_wheel_advance(&worker->wheel, tick, sensor_engine_on_timer, worker);
+        sensor_engine_flush_samples(worker);
+        sensor_engine_flush(worker);
+
+        can_clock_sleep_until_ns(engine->start_ns + (tick + 1) * SENSOR_ENGINE_TICK_NS);
+    }
+
+    return NULL;
+}
+
+// 샘플은 묶음에 모으고 하트비트는 바로 기록한 뒤 다음 마감을 예정 시각 기준으로 다시 걸기 (밀렸으면 현재 틱 기준)
+static void sensor_engine_on_timer(void *ctx, uint32_t timer_id, uint64_t expiry_tick)
+{
+    sensor_engine_worker_t *worker = (sensor_engine_worker_t *)ctx;
+    sensor_engine_t *engine = worker->engine;
+    uint32_t i = worker->first + timer_id / SENSOR_TIMER_KINDS;
+    uint64_t interval;
+
+    if (timer_id % SENSOR_TIMER_KINDS == SENSOR_TIMER_SAMPLE)
+    {
+        if (worker->wave.cnt == SENSOR_WAVE_BATCH)
+        {
+            sensor_engine_flush_samples(worker);
+        }
+        worker->wave.index[worker->wave.cnt] = i;
+        worker->wave.tick[worker->wave.cnt] = expiry_tick;
+        worker->wave.cnt++;
+        interval = engine->sample_interval_ms / SENSOR_ENGINE_TICK_MS;
+    }
+    else
+    {
+        sensor_engine_emit_heartbeat(worker, i, expiry_tick);
+        interval = engine->heartbeat_interval_ms / SENSOR_ENGINE_TICK_MS;
+    }
+
+    if (interval == 0)
+    {
+        interval = 1;
+    }
+
+    uint64_t next = expiry_tick + interval;
+    if (next <= worker->wheel.now_tick)
+    {
+        next = worker->wheel.now_tick + interval;
+    }
+    can_timer_wheel_arm(&worker->wheel, timer_id, next);
+}
+
+// 모아둔 샘플을 한 번에 계산해 송신 배치에 바로 기록
+static void sensor_engine_flush_samples(sensor_engine_worker_t *worker)
+{
+    int n = worker->wave.cnt;
+    if (n == 0)
+    {
+        return;
+    }
+
+    if (worker->batch_cnt + n > SENSOR_ENGINE_SEND_BATCH)
+    {
+        sensor_engine_flush(worker);
+    }
+
+    worker->batch_cnt += sensor_wave_generate(worker->engine, &worker->wave, &worker->batch[worker->batch_cnt]);
+    sensor_engine_counter_add(&worker->samples, (uint64_t)n);
+}
+
+static void sensor_engine_emit_heartbeat(sensor_engine_worker_t *worker, uint32_t i, uint64_t tick)
+{
+    sensor_engine_t *engine = worker->engine;
+
+    can_frame_t *frame = sensor_engine_next_frame(worker);
+    status_msg_t msg;
+    msg.node_id = engine->sensor_id[i];
+    msg.msg_type = MSG_TYPE_HEARTBEAT;
+    msg.system_status = engine->status[i];
+    msg.error_flags = 0;
+    msg.uptime = (uint32_t)(tick * SENSOR_ENGINE_TICK_MS / 1000);
+
+    frame->id = CAN_ID_SYSTEM_BASE + engine->sensor_id[i];
+    frame->dlc = sizeof(status_msg_t);
+    memcpy(frame->data, &msg, sizeof(status_msg_t));
+
+    sensor_engine_counter_add(&worker->heartbeats, 1);
+}
+
+// 배치의 다음 칸 (가득 차 있으면 먼저 송신)
+static can_frame_t *sensor_engine_next_frame(sensor_engine_worker_t *worker)
+{
+    if (worker->batch_cnt == SENSOR_ENGINE_SEND_BATCH)
+    {
+        sensor_engine_flush(worker);
+    }
+
+    can_frame_t *frame = &worker->batch[worker->batch_cnt++];
+    frame->is_extended = false;
+    frame->is_remote = false;
+    frame->timestamp_ns = 0;
+    return frame;
+}
+
+static void sensor_engine_flush(sensor_engine_worker_t *worker)
+{
+    if (worker->batch_cnt == 0)
+    {
+        return;
+    }
+
+    int sent = can_send_batch(&worker->can_interface, worker->batch, worker->batch_cnt);
+    if (sent < worker->batch_cnt)
+    {
+        sensor_engine_counter_add(&worker->dropped, (uint64_t)(worker->batch_cnt - (sent > 0 ? sent : 0)));
+    }
+    worker->batch_cnt = 0;
+}
+
+// 워커만 갱신하는 카운터
+static void sensor_engine_counter_add(_Atomic uint64_t *counter, uint64_t n)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + n, memory_order_relaxed);
+}
+
+static uint8_t sensor_engine_unit(sensor_type_t type)
+{
+    switch (type)
+    {
+    case SENSOR_TYPE_TEMPERATURE:
+        return UNIT_CELSIUS;
+    case SENSOR_TYPE_PRESSURE:
+        return UNIT_BAR;
+    case SENSOR_TYPE_VIBRATION:
+        return UNIT_MM_S;
+    default:
+        return 0;
+    }
+}
+
+// 실행 중인 워커 [0, worker_cnt) 를 멈추고 자원 정리
+static void sensor_engine_close_workers(sensor_engine_t *engine, int worker_cnt)
+{
+    atomic_store(&engine->running, false);
+
+    for (int w = 0; w < worker_cnt; w++)
+    {
+        sensor_engine_worker_t *worker = &engine->workers[w];
+        if (!engine->stepped)
+        {
+            pthread_join(worker->thread, NULL);
+        }
+        worker->wave.cnt = 0;
+        sensor_engine_flush(worker);
+        can_destroy_interface(&worker->can_interface);
+        can_timer_wheel_free(&worker->wheel);
+    }
+}
@@ -0,0 +1,304 @@
+#include "include/sensor_waveform.h"
+#include "include/sensor_engine.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <math.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SENSOR_WAVE_X86 1
+#include <immintrin.h>
+#else
+#define SENSOR_WAVE_X86 0
+#endif
+
+// Philox2x32-10 상수
+#define SENSOR_PHILOX_M 0xD256D193u
+#define SENSOR_PHILOX_W 0x9E3779B9u
+#define SENSOR_PHILOX_ROUNDS 10
+
+#define SENSOR_WAVE_TWO_PI 6.28318530718f
+
+// sin 근사 다항식 계수 (Taylor, 9차)
+#define SENSOR_WAVE_C9 (1.0f / 362880.0f)
+#define SENSOR_WAVE_C7 (1.0f / 5040.0f)
+#define SENSOR_WAVE_C5 (1.0f / 120.0f)
+#define SENSOR_WAVE_C3 (1.0f / 6.0f)
+
+typedef void (*sensor_philox_fn)(const uint32_t *counter_lo, const uint64_t *counter_hi, uint32_t seed_key, uint32_t *out, int n);
+typedef void (*sensor_sin_fn)(const float *phase, float *out, int n);
+
+// 커널 묶음 (함께 바뀌도록 포인터 하나로 교체)
+typedef struct
+{
+    sensor_wave_kernel_t kind;
+    sensor_philox_fn philox;
+    sensor_sin_fn sin;
+} sensor_wave_kernels_t;
+
+static void sensor_philox_scalar(const uint32_t *counter_lo, const uint64_t *counter_hi, uint32_t seed_key, uint32_t *out, int n);
+static void sensor_sin_scalar(const float *phase, float *out, int n);
+#if SENSOR_WAVE_X86
+static void sensor_philox_avx2(const uint32_t *counter_lo, const uint64_t *counter_hi, uint32_t seed_key, uint32_t *out, int n);
+static void sensor_sin_avx2(const float *phase, float *out, int n);
+#endif
+
+static const sensor_wave_kernels_t g_scalar_kernels = {SENSOR_WAVE_KERNEL_SCALAR, sensor_philox_scalar, sensor_sin_scalar};
+#if SENSOR_WAVE_X86
+static const sensor_wave_kernels_t g_avx2_kernels = {SENSOR_WAVE_KERNEL_AVX2, sensor_philox_avx2, sensor_sin_avx2};
+#endif
+
+static _Atomic(const sensor_wave_kernels_t *) g_kernels = NULL;
+static pthread_once_t g_kernel_once = PTHREAD_ONCE_INIT;
+
+static const sensor_wave_kernels_t *sensor_wave_kernels(void);
+static void sensor_wave_detect_kernel(void);
+
+// 카운터 기반 난수 (같은 seed, 카운터면 커널과 관계없이 항상 같은 값, counter_hi 의 상위 32비트는 키에 섞음)
+void sensor_wave_philox(const uint32_t *counter_lo, const uint64_t *counter_hi, uint64_t seed, uint32_t *out, int n)
+{
+    if (!counter_lo || !counter_hi || !out || n <= 0)
+    {
+        return;
+    }
+
+    sensor_wave_kernels()->philox(counter_lo, counter_hi, (uint32_t)seed ^ (uint32_t)(seed >> 32), out, n);
+}
+
+// sin(2π * phase) 근사 (phase: 0.0 ~ 1.0, 최대 오차 약 4e-6, FMA 없이 같은 연산 순서라 커널 간 결과 동일)
+void sensor_wave_sin_turns(const float *phase, float *out, int n)
+{
+    if (!phase || !out || n <= 0)
+    {
+        return;
+    }
+
+    sensor_wave_kernels()->sin(phase, out, n);
+}
+
+// 묶음의 센서값을 계산해 frames 에 센서 데이터 메시지로 기록 (기록한 메시지 수 반환)
+int sensor_wave_generate(struct sensor_engine *engine, sensor_wave_batch_t *batch, can_frame_t *frames)
+{
+    int n = batch->cnt;
+
+    // 센서 상태를 lane 배열로 모음 (위상은 double 로 계산해 긴 가동시간에도 정밀도 유지)
+    for (int k = 0; k < n; k++)
+    {
+        uint32_t i = batch->index[k];
+        double seconds = (double)(batch->tick[k] * SENSOR_ENGINE_TICK_MS) / 1000.0;
+        double cycles = (double)engine->frequency[i] * seconds;
+
+        batch->phase[k] = (float)(cycles - (double)(int64_t)cycles);
+        batch->base[k] = engine->base_value[i];
+        batch->amplitude[k] = engine->amplitude[i];
+        batch->noise_level[k] = engine->noise_level[i];
+        batch->drift[k] = engine->accumulated_drift[i] + engine->drift_rate[i];
+    }
+
+    sensor_wave_philox(batch->index, batch->tick, engine->seed, batch->random, n);
+    sensor_wave_sin_turns(batch->phase, batch->value, n);
+
+    // 값 = 기본값 + 진폭 * sin + 노이즈(-1.0 ~ 1.0) + 누적 드리프트
+    for (int k = 0; k < n; k++)
+    {
+        float noise = (float)(batch->random[k] >> 8) * (1.0f / 8388608.0f) - 1.0f;
+        batch->value[k] = batch->base[k] + batch->amplitude[k] * batch->value[k] +
+                          batch->noise_level[k] * noise + batch->drift[k];
+    }
+
+    for (int k = 0; k < n; k++)
+    {
+        uint32_t i = batch->index[k];
+        engine->accumulated_drift[i] = batch->drift[k];
+        engine->current_value[i] = batch->value[k];
+
+        sensor_data_msg_t msg;
+        msg.sensor_id = engine->sensor_id[i];
+        msg.msg_type = MSG_TYPE_SENSOR_DATA;
+        msg.value = sensor_value_to_raw(batch->value[k]);
+        msg.unit = engine->unit[i];
+        msg.status = engine->status[i];
+        msg.sequence = engine->sequence[i]++;
+
+        can_frame_t *frame = &frames[k];
+        frame->id = engine->can_id[i];
+        frame->dlc = sizeof(sensor_data_msg_t);
+        memcpy(frame->data, &msg, sizeof(sensor_data_msg_t));
+        frame->is_extended = false;
+        frame->is_remote = false;
+        frame->timestamp_ns = 0;
+    }
+
+    batch->cnt = 0;
+    return n;
+}
+
+sensor_wave_kernel_t sensor_wave_kernel(void)
+{
+    return sensor_wave_kernels()->kind;
+}
+
+// 커널 강제 지정 (CPU 가 지원하지 않으면 무시, 성능 비교용, 생성 중인 워커는 다음 묶음부터 사용)
+void sensor_wave_force_kernel(sensor_wave_kernel_t kernel)
+{
+    pthread_once(&g_kernel_once, sensor_wave_detect_kernel);
+
+    switch (kernel)
+    {
+#if SENSOR_WAVE_X86
+    case SENSOR_WAVE_KERNEL_AVX2:
+        if (__builtin_cpu_supports("avx2"))
+        {
+            atomic_store_explicit(&g_kernels, &g_avx2_kernels, memory_order_release);
+        }
+        break;
+#endif
+    default:
+        atomic_store_explicit(&g_kernels, &g_scalar_kernels, memory_order_release);
+        break;
+    }
+}
+
+// ------------- static method -------------
+// 사용할 커널 묶음 (처음 호출할 때 한 번만 CPU 를 확인, 여러 워커가 동시에 불러도 됨)
+static const sensor_wave_kernels_t *sensor_wave_kernels(void)
+{
+    const sensor_wave_kernels_t *kernels = atomic_load_explicit(&g_kernels, memory_order_acquire);
+    if (kernels)
+    {
+        return kernels;
+    }
+
+    pthread_once(&g_kernel_once, sensor_wave_detect_kernel);
+    return atomic_load_explicit(&g_kernels, memory_order_acquire);
+}
+
+static void sensor_wave_detect_kernel(void)
+{
+    const sensor_wave_kernels_t *kernels = &g_scalar_kernels;
+
+#if SENSOR_WAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        kernels = &g_avx2_kernels;
+    }
+#endif
+    atomic_store_explicit(&g_kernels, kernels, memory_order_release);
+}
+
+static void sensor_philox_scalar(const uint32_t *counter_lo, const uint64_t *counter_hi, uint32_t seed_key, uint32_t *out, int n)
+{
+    for (int k = 0; k < n; k++)
+    {
+        uint32_t c0 = counter_lo[k];
+        uint32_t c1 = (uint32_t)counter_hi[k];
+        uint32_t key = seed_key + (uint32_t)(counter_hi[k] >> 32) * SENSOR_PHILOX_W;
+
+        for (int r = 0; r < SENSOR_PHILOX_ROUNDS; r++)
+        {
+            uint64_t product = (uint64_t)SENSOR_PHILOX_M * c0;
+            uint32_t hi = (uint32_t)(product >> 32);
+            uint32_t lo = (uint32_t)product;
+            c0 = hi ^ key ^ c1;
+            c1 = lo;
+            key += SENSOR_PHILOX_W;
+        }
+
+        out[k] = c0;
+    }
+}
+
+static void sensor_sin_scalar(const float *phase, float *out, int n)
+{
+    for (int k = 0; k < n; k++)
+    {
+        // [-0.5, 0.5) 로 옮긴 뒤 sin(π - θ) = sin(θ) 로 [-0.25, 0.25] 까지 접음
+        float x = phase[k] - (float)(int)(phase[k] + 0.5f);
+        float folded = copysignf(0.25f - fabsf(fabsf(x) - 0.25f), x);
+
+        float t = folded * SENSOR_WAVE_TWO_PI;
+        float t2 = t * t;
+        float poly = SENSOR_WAVE_C9;
+        poly = poly * t2 - SENSOR_WAVE_C7;
+        poly = poly * t2 + SENSOR_WAVE_C5;
+        poly = poly * t2 - SENSOR_WAVE_C3;
+        poly = poly * t2 + 1.0f;
+        out[k] = t * poly;
+    }
+}
+
+#if SENSOR_WAVE_X86
+// 8개씩: 32x32->64 곱은 짝수/홀수 레인을 mul_epu32 로 나눠 구한 뒤 상위/하위 32비트를 다시 합침
+__attribute__((target("avx2"))) static void sensor_philox_avx2(const uint32_t *counter_lo, const uint64_t *counter_hi, uint32_t seed_key, uint32_t *out, int n)
+{
+    const __m256i multiplier = _mm256_set1_epi32((int)SENSOR_PHILOX_M);
+    const __m256i weyl = _mm256_set1_epi32((int)SENSOR_PHILOX_W);
+    const __m256i split = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    int k = 0;
+
+    for (; k + 8 <= n; k += 8)
+    {
+        // uint64 카운터 8개를 하위 32비트 / 상위 32비트 레인으로 분리
+        __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(counter_hi + k)), split);
+        __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(counter_hi + k + 4)), split);
+        __m256i hi_lo = _mm256_permute2x128_si256(a, b, 0x20);
+        __m256i hi_hi = _mm256_permute2x128_si256(a, b, 0x31);
+
+        __m256i c0 = _mm256_loadu_si256((const __m256i *)(counter_lo + k));
+        __m256i c1 = hi_lo;
+        __m256i key = _mm256_add_epi32(_mm256_set1_epi32((int)seed_key), _mm256_mullo_epi32(hi_hi, weyl));
+
+        for (int r = 0; r < SENSOR_PHILOX_ROUNDS; r++)
+        {
+            __m256i even = _mm256_mul_epu32(c0, multiplier);
+            __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(c0, 32), multiplier);
+            __m256i hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+            __m256i lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi, key), c1);
+            c1 = lo;
+            key = _mm256_add_epi32(key, weyl);
+        }
+
+        _mm256_storeu_si256((__m256i *)(out + k), c0);
+    }
+
+    if (k < n)
+    {
+        sensor_philox_scalar(counter_lo + k, counter_hi + k, seed_key, out + k, n - k);
+    }
+}
+
+// 8개씩 처리하는 AVX2 버전 (구성과 연산 순서는 스칼라와 동일)
+__attribute__((target("avx2"))) static void sensor_sin_avx2(const float *phase, float *out, int n)
+{
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    const __m256 two_pi = _mm256_set1_ps(SENSOR_WAVE_TWO_PI);
+    int k = 0;
+
+    for (; k + 8 <= n; k += 8)
+    {
+        __m256 p = _mm256_loadu_ps(phase + k);
+        __m256 x = _mm256_sub_ps(p, _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_add_ps(p, half))));
+        __m256 ax = _mm256_andnot_ps(sign_mask, x);
+        __m256 folded = _mm256_sub_ps(quarter, _mm256_andnot_ps(sign_mask, _mm256_sub_ps(ax, quarter)));
+        folded = _mm256_or_ps(folded, _mm256_and_ps(sign_mask, x));
+
+        __m256 t = _mm256_mul_ps(folded, two_pi);
+        __m256 t2 = _mm256_mul_ps(t, t);
+        __m256 poly = _mm256_set1_ps(SENSOR_WAVE_C9);
+        poly = _mm256_sub_ps(_mm256_mul_ps(poly, t2), _mm256_set1_ps(SENSOR_WAVE_C7));
+        poly = _mm256_add_ps(_mm256_mul_ps(poly, t2), _mm256_set1_ps(SENSOR_WAVE_C5));
+        poly = _mm256_sub_ps(_mm256_mul_ps(poly, t2), _mm256_set1_ps(SENSOR_WAVE_C3));
+        poly = _mm256_add_ps(_mm256_mul_ps(poly, t2), _mm256_set1_ps(1.0f));
+        _mm256_storeu_ps(out + k, _mm256_mul_ps(t, poly));
+    }
+
+    if (k < n)
+    {
+        sensor_sin_scalar(phase + k, out + k, n - k);
+    }
+}
+#endif